@@ -67,6 +67,10 @@ public:
         return _data;
     }
 
+    inline constexpr ConstPtr<ValueType> Data() const {
+        return _data;
+    }
+
     inline constexpr SizeType Size() const {
         return SizeValue;
     }
@@ -196,6 +200,11 @@ namespace std {
         return array.Data();
     }
 
+    template<typename ValueT, auto SizeV>
+    constexpr auto data(ConstLRef<Array<ValueT, SizeV>> array) {
+        return array.Data();
+    }
+
     template<typename ValueT, auto SizeV>
     constexpr auto begin(LRef<Array<ValueT, SizeV>> array) {
         return array.begin();
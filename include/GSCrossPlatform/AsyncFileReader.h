@@ -0,0 +1,165 @@
+#ifndef GSCROSSPLATFORM_ASYNCFILEREADER_H
+#define GSCROSSPLATFORM_ASYNCFILEREADER_H
+
+#include <functional>
+#include <future>
+#include <string>
+
+#include <GSCrossPlatform/Map.h>
+#include <GSCrossPlatform/UTF8View.h>
+
+/**
+ * Result of asynchronous file reading
+ */
+class AsyncFileResult {
+public:
+
+    AsyncFileResult()
+            : _error(0) {}
+
+    AsyncFileResult(std::string path, Vector<U8> bytes, I32 error)
+            : _path(std::move(path)), _bytes(std::move(bytes)), _error(error) {}
+
+public:
+
+    /**
+     * Decoding file content from UTF-8 (malformed sequences are replaced with U+FFFD)
+     * @return String
+     */
+    inline UString Decode() const {
+        return UString(ReinterpretCast<ConstPtr<C>>(_bytes.Data()), _bytes.Size());
+    }
+
+    /**
+     * Getting validated UTF-8 view of file content
+     * @return View
+     */
+    inline UTF8View View() const {
+        return UTF8View(_bytes.Data(), _bytes.Size());
+    }
+
+public:
+
+    inline ConstLRef<std::string> Path() const {
+        return _path;
+    }
+
+    inline ConstLRef<Vector<U8>> Bytes() const {
+        return _bytes;
+    }
+
+    inline LRef<Vector<U8>> Bytes() {
+        return _bytes;
+    }
+
+    /**
+     * Getting error code of reading (errno value)
+     * @return Error code or 0
+     */
+    inline I32 Error() const {
+        return _error;
+    }
+
+    inline Bool IsSuccess() const {
+        return _error == 0;
+    }
+
+private:
+
+    std::string _path;
+
+    Vector<U8> _bytes;
+
+    I32 _error;
+};
+
+/**
+ * Backend of asynchronous file reading
+ */
+enum class AsyncFileBackend : U8 {
+    Auto,
+    IOUring,
+    ThreadPool
+};
+
+/**
+ * Batched asynchronous file reader
+ *
+ * Submitted reads are executed by Run, which keeps up to queue depth files in flight.
+ * On Linux open, read and close requests are submitted through io_uring, otherwise (or if io_uring is unavailable)
+ * files are read by thread pool with pread. Callbacks are invoked on thread calling Run
+ */
+class AsyncFileReader {
+public:
+
+    using Callback = std::function<Void(RRef<AsyncFileResult>)>;
+
+public:
+
+    /**
+     * Constructor for reader
+     * @param queueDepth Maximum count of files in flight
+     * @param threadsCount Threads count for thread pool backend (0 for hardware concurrency)
+     * @param backend Backend (Auto for io_uring with thread pool fallback)
+     */
+    explicit AsyncFileReader(U32 queueDepth = 256, U32 threadsCount = 0, AsyncFileBackend backend = AsyncFileBackend::Auto);
+
+    AsyncFileReader(ConstLRef<AsyncFileReader> reader) = delete;
+
+public:
+
+    ~AsyncFileReader();
+
+public:
+
+    /**
+     * Submitting file reading with completion callback
+     * @param path Path to file
+     * @param callback Callback
+     */
+    Void Submit(std::string path, Callback callback);
+
+    /**
+     * Submitting file reading with completion future
+     * @param path Path to file
+     * @return Future of result (ready after completion in Run)
+     */
+    std::future<AsyncFileResult> Submit(std::string path);
+
+    /**
+     * Reading all submitted files, files submitted from callbacks are read by next Run
+     */
+    Void Run();
+
+public:
+
+    inline AsyncFileBackend Backend() const {
+        return _backend;
+    }
+
+public:
+
+    LRef<AsyncFileReader> operator=(ConstLRef<AsyncFileReader> reader) = delete;
+
+private:
+
+    Void RunIOUring(LRef<Vector<Pair<std::string, Callback>>> requests);
+
+    Void RunThreadPool(LRef<Vector<Pair<std::string, Callback>>> requests);
+
+private:
+
+    AsyncFileBackend _backend;
+
+    U32 _queueDepth;
+
+    U32 _threadsCount;
+
+    Vector<Pair<std::string, Callback>> _requests;
+
+    class IOUring;
+
+    Ptr<IOUring> _ring;
+};
+
+#endif //GSCROSSPLATFORM_ASYNCFILEREADER_H
@@ -0,0 +1,346 @@
+#ifndef GSCROSSPLATFORM_CHARACTERCLASS_H
+#define GSCROSSPLATFORM_CHARACTERCLASS_H
+
+#include <bit>
+
+#include <GSCrossPlatform/SIMD.h>
+#include <GSCrossPlatform/UString.h>
+
+enum class CharacterClass : U8 {
+    Whitespace,
+    Digit,
+    IDStart,
+    IDContinue,
+    Newline
+};
+
+/**
+ * Bit masks of character classes for block of up to CharacterClassBlockSize symbols or bytes (bit i for element i)
+ */
+class CharacterClassMasks {
+public:
+
+    constexpr CharacterClassMasks()
+            : _whitespace(0), _digit(0), _idStart(0), _idContinue(0), _newline(0) {}
+
+    constexpr CharacterClassMasks(U64 whitespace, U64 digit, U64 idStart, U64 idContinue, U64 newline)
+            : _whitespace(whitespace), _digit(digit), _idStart(idStart), _idContinue(idContinue), _newline(newline) {}
+
+public:
+
+    inline constexpr U64 Whitespace() const {
+        return _whitespace;
+    }
+
+    inline constexpr U64 Digit() const {
+        return _digit;
+    }
+
+    inline constexpr U64 IDStart() const {
+        return _idStart;
+    }
+
+    inline constexpr U64 IDContinue() const {
+        return _idContinue;
+    }
+
+    inline constexpr U64 Newline() const {
+        return _newline;
+    }
+
+    inline constexpr U64 Mask(CharacterClass characterClass) const {
+        switch (characterClass) {
+            case CharacterClass::Whitespace:
+                return _whitespace;
+            case CharacterClass::Digit:
+                return _digit;
+            case CharacterClass::IDStart:
+                return _idStart;
+            case CharacterClass::IDContinue:
+                return _idContinue;
+            default:
+                return _newline;
+        }
+    }
+
+private:
+
+    U64 _whitespace;
+
+    U64 _digit;
+
+    U64 _idStart;
+
+    U64 _idContinue;
+
+    U64 _newline;
+};
+
+inline constexpr U64 CharacterClassBlockSize = 64;
+
+inline constexpr U64 CharacterClassBlockMask(ConstLRef<U64> size) {
+    return size >= CharacterClassBlockSize ? ~0ULL : (1ULL << size) - 1;
+}
+
+/**
+ * Classifying ASCII bytes, SIMD comparisons below must agree with UnicodeTables.h
+ * @param bytes Bytes (CharacterClassBlockSize ASCII bytes)
+ * @return Masks
+ */
+inline CharacterClassMasks ClassifyASCIIBlock(ConstPtr<U8> bytes) {
+#if defined(GS_SIMD_VECTOR)
+
+    U64 whitespace = 0, digit = 0, idStart = 0, idContinue = 0, newline = 0;
+
+    for (U64 offset = 0; offset < CharacterClassBlockSize; offset += SIMDVectorSize) {
+        auto vector = SIMDLoad(bytes + offset);
+
+        auto letterVector = SIMDInRange(SIMDOr(vector, SIMDSplat(0x20)), 'a', 'z');
+
+        auto digitVector = SIMDInRange(vector, '0', '9');
+
+        auto whitespaceVector = SIMDOr(SIMDInRange(vector, 0x09, 0x0D), SIMDInRange(vector, 0x1C, 0x20));
+
+        auto ignorableVector = SIMDOr(SIMDOr(SIMDInRange(vector, 0x00, 0x08), SIMDInRange(vector, 0x0E, 0x1B)),
+                                      SIMDEqual(vector, SIMDSplat(0x7F)));
+
+        auto idContinueVector = SIMDOr(SIMDOr(letterVector, digitVector),
+                                       SIMDOr(SIMDEqual(vector, SIMDSplat('_')), ignorableVector));
+
+        whitespace |= SIMDMoveMask(whitespaceVector) << offset;
+
+        digit |= SIMDMoveMask(digitVector) << offset;
+
+        idStart |= SIMDMoveMask(letterVector) << offset;
+
+        idContinue |= SIMDMoveMask(idContinueVector) << offset;
+
+        newline |= SIMDMoveMask(SIMDEqual(vector, SIMDSplat('\n'))) << offset;
+    }
+
+    return CharacterClassMasks(whitespace, digit, idStart, idContinue, newline);
+
+#else
+
+    U64 whitespace = 0, digit = 0, idStart = 0, idContinue = 0, newline = 0;
+
+    for (U64 index = 0; index < CharacterClassBlockSize; ++index) {
+        auto properties = UnicodeTablesASCIIRecords[bytes[index]];
+
+        whitespace |= StaticCast<U64>((properties & UnicodeWhitespaceFlag) != 0) << index;
+
+        digit |= StaticCast<U64>((properties & UnicodeDigitFlag) != 0) << index;
+
+        idStart |= StaticCast<U64>((properties & UnicodeIDStartFlag) != 0) << index;
+
+        idContinue |= StaticCast<U64>((properties & UnicodeIDContinueFlag) != 0) << index;
+
+        newline |= StaticCast<U64>(bytes[index] == '\n') << index;
+    }
+
+    return CharacterClassMasks(whitespace, digit, idStart, idContinue, newline);
+
+#endif
+}
+
+inline constexpr Bool IsASCIIBlock(ConstPtr<U8> bytes) {
+    U64 bytesMask = 0;
+
+    for (U64 index = 0; index < CharacterClassBlockSize; ++index) {
+        bytesMask |= bytes[index];
+    }
+
+    return bytesMask < 0x80;
+}
+
+/**
+ * Classifying block of code points
+ * @param symbols Symbols
+ * @param size Symbols count (only first CharacterClassBlockSize symbols are classified)
+ * @return Masks
+ */
+inline CharacterClassMasks ClassifySymbols(ConstPtr<USymbol> symbols, ConstLRef<U64> size) {
+    if (size >= CharacterClassBlockSize) {
+        U32 codePointsMask = 0;
+
+        for (U64 index = 0; index < CharacterClassBlockSize; ++index) {
+            codePointsMask |= symbols[index].CodePoint();
+        }
+
+        if (codePointsMask < 0x80) {
+            U8 bytes[CharacterClassBlockSize];
+
+            for (U64 index = 0; index < CharacterClassBlockSize; ++index) {
+                bytes[index] = StaticCast<U8>(symbols[index].CodePoint());
+            }
+
+            return ClassifyASCIIBlock(bytes);
+        }
+    }
+
+    U64 whitespace = 0, digit = 0, idStart = 0, idContinue = 0, newline = 0;
+
+    auto blockSize = size < CharacterClassBlockSize ? size : CharacterClassBlockSize;
+
+    for (U64 index = 0; index < blockSize; ++index) {
+        auto codePoint = symbols[index].CodePoint();
+
+        auto properties = UnicodePropertiesOf(codePoint);
+
+        whitespace |= StaticCast<U64>((properties & UnicodeWhitespaceFlag) != 0) << index;
+
+        digit |= StaticCast<U64>((properties & UnicodeDigitFlag) != 0) << index;
+
+        idStart |= StaticCast<U64>((properties & UnicodeIDStartFlag) != 0) << index;
+
+        idContinue |= StaticCast<U64>((properties & UnicodeIDContinueFlag) != 0) << index;
+
+        newline |= StaticCast<U64>(codePoint == '\n') << index;
+    }
+
+    return CharacterClassMasks(whitespace, digit, idStart, idContinue, newline);
+}
+
+/**
+ * Classifying block of UTF-8 bytes, all bytes of multibyte sequence get classes of its code point
+ * @param bytes Bytes
+ * @param size Bytes count (only first CharacterClassBlockSize bytes are classified, rest used for decoding)
+ * @return Masks
+ */
+inline CharacterClassMasks ClassifyUTF8(ConstPtr<U8> bytes, ConstLRef<U64> size) {
+    if (size >= CharacterClassBlockSize && IsASCIIBlock(bytes)) {
+        return ClassifyASCIIBlock(bytes);
+    }
+
+    U64 whitespace = 0, digit = 0, idStart = 0, idContinue = 0, newline = 0;
+
+    auto blockSize = size < CharacterClassBlockSize ? size : CharacterClassBlockSize;
+
+    for (U64 index = 0; index < blockSize;) {
+        U32 codePoint;
+
+        auto symbolSize = FromUTF8(bytes + index, size - index, codePoint);
+
+        auto properties = UnicodePropertiesOf(codePoint);
+
+        auto symbolBits = ((1ULL << symbolSize) - 1) << index;
+
+        whitespace |= (properties & UnicodeWhitespaceFlag) != 0 ? symbolBits : 0;
+
+        digit |= (properties & UnicodeDigitFlag) != 0 ? symbolBits : 0;
+
+        idStart |= (properties & UnicodeIDStartFlag) != 0 ? symbolBits : 0;
+
+        idContinue |= (properties & UnicodeIDContinueFlag) != 0 ? symbolBits : 0;
+
+        newline |= codePoint == '\n' ? symbolBits : 0;
+
+        index += symbolSize;
+    }
+
+    auto blockMask = CharacterClassBlockMask(blockSize);
+
+    return CharacterClassMasks(whitespace & blockMask, digit & blockMask, idStart & blockMask, idContinue & blockMask, newline & blockMask);
+}
+
+/**
+ * Finding end of run of symbols with character class
+ * @param string String
+ * @param position Start position
+ * @param characterClass Character class
+ * @return Position of first symbol without character class or string size
+ */
+inline U64 ScanCharacterClass(UStringView string, U64 position, CharacterClass characterClass) {
+    auto size = string.Size();
+
+    while (position < size) {
+        auto blockSize = size - position < CharacterClassBlockSize ? size - position : CharacterClassBlockSize;
+
+        auto outsideMask = ~ClassifySymbols(string.Data() + position, blockSize).Mask(characterClass) & CharacterClassBlockMask(blockSize);
+
+        if (outsideMask != 0) {
+            return position + std::countr_zero(outsideMask);
+        }
+
+        position += blockSize;
+    }
+
+    return size;
+}
+
+/**
+ * Finding end of run of UTF-8 encoded symbols with character class
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param position Start position (must be on symbol boundary)
+ * @param characterClass Character class
+ * @return Position of first byte of symbol without character class or bytes count
+ */
+inline U64 ScanCharacterClass(ConstPtr<U8> bytes, ConstLRef<U64> size, U64 position, CharacterClass characterClass) {
+    while (position < size) {
+        auto blockSize = size - position < CharacterClassBlockSize ? size - position : CharacterClassBlockSize;
+
+        auto outsideMask = ~ClassifyUTF8(bytes + position, size - position).Mask(characterClass) & CharacterClassBlockMask(blockSize);
+
+        if (outsideMask != 0) {
+            return position + std::countr_zero(outsideMask);
+        }
+
+        position += blockSize;
+
+        // last symbol of block can continue in next block
+        for (U64 index = 0; index < 3 && position < size && (bytes[position] & 0xC0) == 0x80; ++index) {
+            --position;
+        }
+    }
+
+    return size;
+}
+
+inline U64 SkipWhitespace(UStringView string, U64 position) {
+    return ScanCharacterClass(string, position, CharacterClass::Whitespace);
+}
+
+inline U64 SkipWhitespace(ConstPtr<U8> bytes, ConstLRef<U64> size, U64 position) {
+    return ScanCharacterClass(bytes, size, position, CharacterClass::Whitespace);
+}
+
+inline U64 ScanDigits(UStringView string, U64 position) {
+    return ScanCharacterClass(string, position, CharacterClass::Digit);
+}
+
+inline U64 ScanDigits(ConstPtr<U8> bytes, ConstLRef<U64> size, U64 position) {
+    return ScanCharacterClass(bytes, size, position, CharacterClass::Digit);
+}
+
+/**
+ * Scanning identifier (IDStart IDContinue*)
+ * @param string String
+ * @param position Start position
+ * @return End position of identifier or start position if there is no identifier
+ */
+inline U64 ScanIdentifier(UStringView string, U64 position) {
+    if (position >= string.Size() || !string.Data()[position].IsIDStart()) {
+        return position;
+    }
+
+    return ScanCharacterClass(string, position + 1, CharacterClass::IDContinue);
+}
+
+inline U64 ScanIdentifier(ConstPtr<U8> bytes, ConstLRef<U64> size, U64 position) {
+    if (position >= size) {
+        return position;
+    }
+
+    U32 codePoint;
+
+    auto symbolSize = FromUTF8(bytes + position, size - position, codePoint);
+
+    if (!USymbol(codePoint).IsIDStart()) {
+        return position;
+    }
+
+    return ScanCharacterClass(bytes, size, position + symbolSize, CharacterClass::IDContinue);
+}
+
+#endif //GSCROSSPLATFORM_CHARACTERCLASS_H
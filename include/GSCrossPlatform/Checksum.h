@@ -0,0 +1,125 @@
+#ifndef GSCROSSPLATFORM_CHECKSUM_H
+#define GSCROSSPLATFORM_CHECKSUM_H
+
+#include <cstring>
+#include <type_traits>
+
+#include <GSCrossPlatform/Array.h>
+#include <GSCrossPlatform/SIMD.h>
+
+#if defined(GS_SIMD_SSE4)
+
+    #include <nmmintrin.h>
+
+#elif defined(__ARM_FEATURE_CRC32)
+
+    #include <arm_acle.h>
+
+#endif
+
+/**
+ * Making tables of CRC32C (Castagnoli, reflected polynomial 0x82F63B78) for calculation by 8 bytes (slicing-by-8)
+ * @return Tables, table K is at offset K * 256
+ */
+inline constexpr Array<U32, 8 * 256> MakeCRC32CTable() {
+    Array<U32, 8 * 256> table;
+
+    for (U32 byte = 0; byte < 256; ++byte) {
+        auto crc = byte;
+
+        for (U32 bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (crc & 1 ? 0x82F63B78 : 0);
+        }
+
+        table[byte] = crc;
+    }
+
+    for (U32 index = 256; index < 8 * 256; ++index) {
+        auto previous = table[index - 256];
+
+        table[index] = (previous >> 8) ^ table[previous & 0xFF];
+    }
+
+    return table;
+}
+
+inline constexpr Array<U32, 8 * 256> CRC32CTable = MakeCRC32CTable();
+
+/**
+ * Calculating CRC32C checksum (hardware instructions are used if available)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param crc Checksum of previous bytes for continuation
+ * @return Checksum
+ */
+template<typename ByteT>
+inline constexpr U32 CRC32C(ConstPtr<ByteT> bytes, ConstLRef<U64> size, U32 crc = 0) {
+    static_assert(sizeof(ByteT) == 1, "CRC32C(ConstPtr<ByteT>, ConstLRef<U64>, U32): Bytes must be one byte type!");
+
+    crc = ~crc;
+
+    U64 position = 0;
+
+    if (!std::is_constant_evaluated()) {
+#if defined(GS_SIMD_SSE4) && (defined(__x86_64__) || defined(_M_X64))
+
+        U64 value = crc;
+
+        for (; position + 8 <= size; position += 8) {
+            U64 word;
+
+            std::memcpy(&word, bytes + position, 8);
+
+            value = _mm_crc32_u64(value, word);
+        }
+
+        crc = StaticCast<U32>(value);
+
+        for (; position < size; ++position) {
+            crc = _mm_crc32_u8(crc, StaticCast<U8>(bytes[position]));
+        }
+
+#elif defined(__ARM_FEATURE_CRC32)
+
+        for (; position + 8 <= size; position += 8) {
+            U64 word;
+
+            std::memcpy(&word, bytes + position, 8);
+
+            crc = __crc32cd(crc, word);
+        }
+
+        for (; position < size; ++position) {
+            crc = __crc32cb(crc, StaticCast<U8>(bytes[position]));
+        }
+
+#endif
+    }
+
+    auto table = CRC32CTable.Data();
+
+    for (; position + 8 <= size; position += 8) {
+        U32 low = 0, high = 0;
+
+        for (U64 index = 0; index < 4; ++index) {
+            low |= StaticCast<U32>(StaticCast<U8>(bytes[position + index])) << (index * 8);
+
+            high |= StaticCast<U32>(StaticCast<U8>(bytes[position + 4 + index])) << (index * 8);
+        }
+
+        low ^= crc;
+
+        crc = table[7 * 256 + (low & 0xFF)] ^ table[6 * 256 + ((low >> 8) & 0xFF)]
+              ^ table[5 * 256 + ((low >> 16) & 0xFF)] ^ table[4 * 256 + (low >> 24)]
+              ^ table[3 * 256 + (high & 0xFF)] ^ table[2 * 256 + ((high >> 8) & 0xFF)]
+              ^ table[256 + ((high >> 16) & 0xFF)] ^ table[high >> 24];
+    }
+
+    for (; position < size; ++position) {
+        crc = table[(crc ^ StaticCast<U8>(bytes[position])) & 0xFF] ^ (crc >> 8);
+    }
+
+    return ~crc;
+}
+
+#endif //GSCROSSPLATFORM_CHECKSUM_H
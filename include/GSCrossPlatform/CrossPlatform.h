@@ -3,13 +3,30 @@
 
 #include <GSCrossPlatform/Defines.h>
 #include <GSCrossPlatform/Types.h>
+#include <GSCrossPlatform/SIMD.h>
 #include <GSCrossPlatform/Array.h>
 #include <GSCrossPlatform/Vector.h>
 #include <GSCrossPlatform/Map.h>
+#include <GSCrossPlatform/UnicodeTables.h>
 #include <GSCrossPlatform/UString.h>
+#include <GSCrossPlatform/Segmentation.h>
+#include <GSCrossPlatform/CharacterClass.h>
 #include <GSCrossPlatform/IO.h>
+#include <GSCrossPlatform/UTF8View.h>
+#include <GSCrossPlatform/LineIndex.h>
+#include <GSCrossPlatform/MappedFile.h>
+#include <GSCrossPlatform/AsyncFileReader.h>
+#include <GSCrossPlatform/Checksum.h>
+#include <GSCrossPlatform/SourceCache.h>
+#include <GSCrossPlatform/LogSink.h>
+#include <GSCrossPlatform/Serialization.h>
 #include <GSCrossPlatform/Memory.h>
 #include <GSCrossPlatform/UException.h>
 #include <GSCrossPlatform/Encoding.h>
+#include <GSCrossPlatform/UTF8Codec.h>
+#include <GSCrossPlatform/ParallelTranscoding.h>
+#include <GSCrossPlatform/Format.h>
+#include <GSCrossPlatform/Parse.h>
+#include <GSCrossPlatform/Pattern.h>
 
 #endif //GSCROSSPLATFORM_CROSSPLATFORM_H
@@ -28,6 +28,25 @@
     #define GS_COMPILER_MINGW
 #endif
 
+/**
+ * Checking for SIMD instruction sets (enabled by compiler flags, e.g. '-mavx2' or '/arch:AVX2')
+ */
+#if defined(__AVX2__)
+    #define GS_SIMD_AVX2
+#endif
+
+#if defined(__SSE4_2__) || defined(GS_SIMD_AVX2)
+    #define GS_SIMD_SSE4
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(GS_SIMD_SSE4)
+    #define GS_SIMD_SSE2
+#endif
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+    #define GS_SIMD_NEON
+#endif
+
 /**
  * Enabling or disabling OS and compiler checks
  */
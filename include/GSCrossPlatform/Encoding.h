@@ -1,12 +1,26 @@
 #ifndef GSCROSSPLATFORM_ENCODING_H
 #define GSCROSSPLATFORM_ENCODING_H
 
+#include <bit>
+#include <cstring>
 #include <string>
 
+#include <GSCrossPlatform/Array.h>
+#include <GSCrossPlatform/SIMD.h>
 #include <GSCrossPlatform/Vector.h>
 
 inline constexpr U32 InvalidCodePoint = 0x10FFFF + 1;
 
+inline constexpr U32 ReplacementCodePoint = 0xFFFD;
+
+/**
+ * Handling of malformed UTF-8: throwing an exception or replacing each maximal subpart with U+FFFD
+ */
+enum class UTF8ErrorMode : U8 {
+    Strict,
+    Replace
+};
+
 inline constexpr U8 UTF8Size(ConstLRef<U32> codePoint) {
     auto size = 0;
 
@@ -87,135 +101,2244 @@ inline constexpr U32 FromUTF8(ConstLRef<Vector<U8>> bytes) {
     return codePoint;
 }
 
-// TODO add supporting UTF-16
+/**
+ * Decoding UTF-8 code point with validation (overlong forms, surrogates and truncated sequences are malformed)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param codePoint Code point or InvalidCodePoint for malformed sequence
+ * @return Count of decoded bytes (maximal subpart length for malformed sequence)
+ */
+template<typename ByteT>
+inline constexpr U8 FromUTF8(ConstPtr<ByteT> bytes, ConstLRef<U64> size, LRef<U32> codePoint) noexcept {
+    static_assert(sizeof(ByteT) == 1, "FromUTF8(ConstPtr<ByteT>, ConstLRef<U64>, LRef<U32>): Bytes must be one byte type!");
 
-inline constexpr Vector<U8> ToUTF16(ConstLRef<U32> codePoint) {
-    Vector<U8> bytes;
+    codePoint = InvalidCodePoint;
 
-//        if (codePoint <= 0xD7FF || (codePoint >= 0xE000 && codePoint <= 0xFFFF)) {
-//            bytes.emplace_back(codePoint >> 8);
-//            bytes.emplace_back(codePoint & 0xFF);
-//        } else {
-//            uint16_t high = ((codePoint - 0x10000) >> 10)  + 0xD800;
-//            uint16_t low = ((codePoint - 0x10000) & 0x3FF) + 0xDC00;
-//            bytes.emplace_back(high >> 8);
-//            bytes.emplace_back(high & 0xFF);
-//            bytes.emplace_back(low >> 8);
-//            bytes.emplace_back(low & 0xFF);
-//        }
+    if (size == 0) {
+        return 0;
+    }
 
-    return bytes;
-}
+    auto byte = StaticCast<U8>(bytes[0]);
 
-inline constexpr U32 FromUTF16(ConstLRef<Vector<U8>> bytes) {
-    auto codePoint = InvalidCodePoint;
+    if (byte < 0x80) {
+        codePoint = byte;
 
-//        auto Size = utf16_size();
-//
-//        if (Size == 2) {
-//            codePoint = (bytes[0] << 8)
-//                       + bytes[1];
-//        }
-//        if (Size == 4) {
-//            codePoint = 0x10000 + ((((bytes[0] << 8) + bytes[1]) - 0xD800) << 10)
-//                    + (((bytes[2] << 8) + bytes[3]) - 0xDC00);
-//        }
+        return 1;
+    }
 
-    return codePoint;
-}
+    U8 symbolSize = 0;
 
-inline constexpr Vector<U8> ToUTF32(ConstLRef<U32> codePoint) {
-    Vector<U8> bytes;
+    U32 value = 0;
 
-    bytes.Append(codePoint >> 24);
-    bytes.Append((codePoint >> 16) & 0xFF);
-    bytes.Append((codePoint >> 8) & 0xFF);
-    bytes.Append(codePoint & 0xFF);
+    U8 lowerBound = 0x80;
 
-    return bytes;
-}
+    U8 upperBound = 0xBF;
 
-inline constexpr U32 FromUTF32(ConstLRef<Vector<U8>> bytes) {
-    auto codePoint = InvalidCodePoint;
+    if (byte >= 0xC2 && byte <= 0xDF) {
+        symbolSize = 2;
 
-    codePoint = (bytes[0] << 24)
-                + (bytes[1] << 16)
-                + (bytes[2] << 8)
-                + bytes[3];
+        value = byte & 0x1F;
+    } else if (byte >= 0xE0 && byte <= 0xEF) {
+        symbolSize = 3;
 
-    return codePoint;
+        value = byte & 0x0F;
+
+        lowerBound = byte == 0xE0 ? 0xA0 : 0x80;
+
+        upperBound = byte == 0xED ? 0x9F : 0xBF;
+    } else if (byte >= 0xF0 && byte <= 0xF4) {
+        symbolSize = 4;
+
+        value = byte & 0x07;
+
+        lowerBound = byte == 0xF0 ? 0x90 : 0x80;
+
+        upperBound = byte == 0xF4 ? 0x8F : 0xBF;
+    } else {
+        return 1;
+    }
+
+    for (U8 index = 1; index < symbolSize; ++index) {
+        if (index >= size || StaticCast<U8>(bytes[index]) < lowerBound || StaticCast<U8>(bytes[index]) > upperBound) {
+            return index;
+        }
+
+        value = (value << 6) | (StaticCast<U8>(bytes[index]) & 0x3F);
+
+        lowerBound = 0x80;
+
+        upperBound = 0xBF;
+    }
+
+    codePoint = value;
+
+    return symbolSize;
 }
 
-inline std::u16string UTF8ToUTF16(ConstLRef<std::string> string) {
-    std::u16string u16string;
+/**
+ * Finding first malformed UTF-8 sequence without SIMD
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param position Start position (must be on symbol boundary)
+ * @return Position of first malformed sequence or bytes count
+ */
+template<typename ByteT>
+inline constexpr U64 FindUTF8ErrorScalar(ConstPtr<ByteT> bytes, ConstLRef<U64> size, U64 position) {
+    while (position < size) {
+        if (!std::is_constant_evaluated() && position + 8 <= size) {
+            U64 word;
 
-    return u16string;
+            std::memcpy(&word, bytes + position, 8);
+
+            if ((word & 0x8080808080808080ULL) == 0) {
+                position += 8;
+
+                continue;
+            }
+        }
+
+        if (StaticCast<U8>(bytes[position]) < 0x80) {
+            ++position;
+
+            continue;
+        }
+
+        U32 codePoint;
+
+        auto symbolSize = FromUTF8(bytes + position, size - position, codePoint);
+
+        if (codePoint == InvalidCodePoint) {
+            return position;
+        }
+
+        position += symbolSize;
+    }
+
+    return size;
 }
 
-inline std::u32string UTF8ToUTF32(ConstLRef<std::string> string) {
-    std::u32string u32string;
+#if defined(GS_SIMD_LOOKUP)
+
+/**
+ * Vectorized UTF-8 validation with lookup tables by high and low nibbles of byte pairs
+ * (Keiser, Lemire "Validating UTF-8 In Less Than One Instruction Per Byte")
+ */
+class UTF8SIMDValidator {
+public:
+
+    UTF8SIMDValidator()
+            : _error(SIMDSplat(0)), _previousInput(SIMDSplat(0)), _previousIncomplete(SIMDSplat(0)) {}
+
+public:
+
+    /**
+     * Checking block of UTF8SIMDValidator::BlockSize bytes
+     * @param bytes Bytes
+     */
+    inline Void CheckBlock(ConstPtr<U8> bytes) {
+        SIMDVector inputs[BlockSize / SIMDVectorSize];
 
-    for (U64 index = 0; index < string.size(); ++index) {
-        auto byte = StaticCast<U8>(string[index]);
+        auto asciiMask = SIMDSplat(0);
 
-        auto symbolSize = UTF8Size(byte);
+        for (U64 index = 0; index < BlockSize / SIMDVectorSize; ++index) {
+            inputs[index] = SIMDLoad(bytes + index * SIMDVectorSize);
 
-        Vector<U8> bytes;
+            asciiMask = SIMDOr(asciiMask, inputs[index]);
+        }
 
-        bytes.Append(byte);
+        if (SIMDMoveMask(asciiMask) == 0) {
+            // sequence from previous block can't be continued by ASCII bytes
+            _error = SIMDOr(_error, _previousIncomplete);
 
-        for (U64 i = 1; i < symbolSize; ++i) {
-            ++index;
+            _previousInput = inputs[BlockSize / SIMDVectorSize - 1];
 
-            byte = StaticCast<U8>(string[index]);
+            _previousIncomplete = SIMDSplat(0);
 
-            bytes.Append(byte);
+            return;
         }
 
-        auto codePoint = FromUTF8(bytes);
+        for (auto &input : inputs) {
+            CheckVector(input);
+        }
 
-        u32string += StaticCast<C32>(codePoint);
+        _previousIncomplete = IsIncomplete(inputs[BlockSize / SIMDVectorSize - 1]);
     }
 
-    return u32string;
+    inline Bool HasError() const {
+        return !SIMDIsZero(_error);
+    }
+
+public:
+
+    inline static constexpr U64 BlockSize = 64;
+
+private:
+
+    inline Void CheckVector(SIMDVector input) {
+        constexpr U8 tooShort = 1 << 0, tooLong = 1 << 1, overlong3 = 1 << 2, tooLarge = 1 << 3, surrogate = 1 << 4,
+                     overlong2 = 1 << 5, tooLarge1000 = 1 << 6, overlong4 = 1 << 6, twoContinuations = 1 << 7,
+                     carry = tooShort | tooLong | twoContinuations;
+
+        static constexpr U8 byte1HighTable[16] = {
+                tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+                twoContinuations, twoContinuations, twoContinuations, twoContinuations,
+                tooShort | overlong2,
+                tooShort,
+                tooShort | overlong3 | surrogate,
+                tooShort | tooLarge | tooLarge1000 | overlong4
+        };
+
+        static constexpr U8 byte1LowTable[16] = {
+                carry | overlong3 | overlong2 | overlong4,
+                carry | overlong2,
+                carry,
+                carry,
+                carry | tooLarge,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000 | surrogate,
+                carry | tooLarge | tooLarge1000,
+                carry | tooLarge | tooLarge1000
+        };
+
+        static constexpr U8 byte2HighTable[16] = {
+                tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+                tooLong | overlong2 | twoContinuations | overlong3 | tooLarge1000 | overlong4,
+                tooLong | overlong2 | twoContinuations | overlong3 | tooLarge,
+                tooLong | overlong2 | twoContinuations | surrogate | tooLarge,
+                tooLong | overlong2 | twoContinuations | surrogate | tooLarge,
+                tooShort, tooShort, tooShort, tooShort
+        };
+
+        auto previous1 = SIMDPrevious<1>(input, _previousInput);
+
+        auto specialCases = SIMDAnd(SIMDAnd(SIMDLookup(SIMDTable(byte1HighTable), SIMDHighNibbles(previous1)),
+                                            SIMDLookup(SIMDTable(byte1LowTable), SIMDAnd(previous1, SIMDSplat(0x0F)))),
+                                    SIMDLookup(SIMDTable(byte2HighTable), SIMDHighNibbles(input)));
+
+        // third and fourth bytes of sequences must be continuations, other continuations are errors
+        auto isThirdByte = SIMDSubtractSaturated(SIMDPrevious<2>(input, _previousInput), SIMDSplat(0xE0 - 0x80));
+
+        auto isFourthByte = SIMDSubtractSaturated(SIMDPrevious<3>(input, _previousInput), SIMDSplat(0xF0 - 0x80));
+
+        auto mustBeContinuation = SIMDAnd(SIMDOr(isThirdByte, isFourthByte), SIMDSplat(0x80));
+
+        _error = SIMDOr(_error, SIMDXor(mustBeContinuation, specialCases));
+
+        _previousInput = input;
+    }
+
+    static inline SIMDVector IsIncomplete(SIMDVector input) {
+        static constexpr auto maxValues = [] {
+            Array<U8, SIMDVectorSize> values;
+
+            for (auto &value : values) {
+                value = 0xFF;
+            }
+
+            values[SIMDVectorSize - 3] = 0xF0 - 1;
+
+            values[SIMDVectorSize - 2] = 0xE0 - 1;
+
+            values[SIMDVectorSize - 1] = 0xC0 - 1;
+
+            return values;
+        }();
+
+        return SIMDSubtractSaturated(input, SIMDLoad(maxValues.Data()));
+    }
+
+private:
+
+    SIMDVector _error;
+
+    SIMDVector _previousInput;
+
+    SIMDVector _previousIncomplete;
+};
+
+#endif
+
+#if defined(GS_SIMD_LOOKUP)
+
+/**
+ * Skipping 64 bytes blocks of valid UTF-8
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @return Position to continue validation from (start of sequence, which can begin before first invalid block)
+ */
+inline U64 SkipValidUTF8Blocks(ConstPtr<U8> bytes, ConstLRef<U64> size) {
+    U64 position = 0;
+
+    UTF8SIMDValidator validator;
+
+    while (position + UTF8SIMDValidator::BlockSize <= size) {
+        validator.CheckBlock(bytes + position);
+
+        if (validator.HasError()) {
+            break;
+        }
+
+        position += UTF8SIMDValidator::BlockSize;
+    }
+
+    for (U64 index = 0; index < 4 && position > 0 && bytes[position - 1] >= 0x80; ++index) {
+        --position;
+
+        if (bytes[position] >= 0xC0) {
+            break;
+        }
+    }
+
+    return position;
 }
 
-#if defined(__cpp_lib_char8_t)
+#endif
 
-inline std::u16string UTF8ToUTF16(ConstLRef<std::u8string> string) {
-    std::u16string u16string;
+/**
+ * Finding first malformed UTF-8 sequence (overlong forms, surrogates, code points above U+10FFFF, truncated sequences)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @return Position of first malformed sequence or bytes count for valid UTF-8
+ */
+template<typename ByteT>
+inline constexpr U64 FindUTF8Error(ConstPtr<ByteT> bytes, ConstLRef<U64> size) {
+    U64 position = 0;
 
-    return u16string;
+#if defined(GS_SIMD_LOOKUP)
+
+    if (!std::is_constant_evaluated()) {
+        position = SkipValidUTF8Blocks(ReinterpretCast<ConstPtr<U8>>(bytes), size);
+    }
+
+#endif
+
+    return FindUTF8ErrorScalar(bytes, size, position);
 }
 
-inline std::u32string UTF8ToUTF32(ConstLRef<std::u8string> string) {
-    std::u32string u32string;
+template<typename ByteT>
+inline constexpr Bool IsValidUTF8(ConstPtr<ByteT> bytes, ConstLRef<U64> size) {
+    return FindUTF8Error(bytes, size) == size;
+}
 
-    return u32string;
+/**
+ * Reading code point from element of code points buffer (integer or USymbol like type)
+ */
+template<typename CodePointT>
+inline constexpr U32 CodePointValue(ConstLRef<CodePointT> value) {
+    if constexpr (std::is_class_v<CodePointT>) {
+        return value.CodePoint();
+    } else {
+        return StaticCast<U32>(value);
+    }
+}
+
+/**
+ * Counting bytes in range [lower, upper]
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param lower Lower bound
+ * @param upper Upper bound
+ * @return Bytes count
+ */
+template<typename ByteT>
+inline constexpr U64 CountBytesInRange(ConstPtr<ByteT> bytes, ConstLRef<U64> size, U8 lower, U8 upper) {
+    U64 position = 0, count = 0;
+
+#if defined(GS_SIMD_VECTOR)
+
+    if (!std::is_constant_evaluated()) {
+        auto data = ReinterpretCast<ConstPtr<U8>>(bytes);
+
+        // byte counters are flushed before overflow
+        while (position + SIMDVectorSize <= size) {
+            auto counters = SIMDSplat(0);
+
+            for (U64 iteration = 0; iteration < 255 && position + SIMDVectorSize <= size; ++iteration, position += SIMDVectorSize) {
+                counters = SIMDSubtract(counters, SIMDInRange(SIMDLoad(data + position), lower, upper));
+            }
+
+            count += SIMDSumBytes(counters);
+        }
+    }
+
+#endif
+
+    for (; position < size; ++position) {
+        count += StaticCast<U8>(StaticCast<U8>(bytes[position]) - lower) <= StaticCast<U8>(upper - lower);
+    }
+
+    return count;
+}
+
+/**
+ * Counting symbols in valid UTF-8 (bytes which are not continuation bytes)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @return Symbols count
+ */
+template<typename ByteT>
+inline constexpr U64 CountUTF8Symbols(ConstPtr<ByteT> bytes, ConstLRef<U64> size) {
+    return size - CountBytesInRange(bytes, size, 0x80, 0xBF);
+}
+
+/**
+ * Finding symbol index of byte offset in valid UTF-8
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param offset Byte offset
+ * @return Count of symbols starting before offset (index of symbol starting at offset)
+ */
+template<typename ByteT>
+inline constexpr U64 UTF8IndexOfOffset(ConstPtr<ByteT> bytes, ConstLRef<U64> size, ConstLRef<U64> offset) {
+    return CountUTF8Symbols(bytes, offset < size ? offset : size);
 }
 
+/**
+ * Finding byte offset of symbol in valid UTF-8
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param index Symbol index
+ * @return Byte offset of symbol or bytes count if index is not less than symbols count
+ */
+template<typename ByteT>
+inline constexpr U64 UTF8OffsetOfIndex(ConstPtr<ByteT> bytes, ConstLRef<U64> size, U64 index) {
+    U64 position = 0;
+
+#if defined(GS_SIMD_VECTOR)
+
+    if (!std::is_constant_evaluated()) {
+        auto data = ReinterpretCast<ConstPtr<U8>>(bytes);
+
+        for (; position + SIMDVectorSize <= size; position += SIMDVectorSize) {
+            auto leadMask = ~SIMDMoveMask(SIMDInRange(SIMDLoad(data + position), 0x80, 0xBF)) & ((1ULL << (SIMDVectorSize - 1)) * 2 - 1);
+
+            auto leadsCount = StaticCast<U64>(std::popcount(leadMask));
+
+            if (index < leadsCount) {
+                // clearing lowest bits of leads before symbol
+                for (; index > 0; --index) {
+                    leadMask &= leadMask - 1;
+                }
+
+                return position + std::countr_zero(leadMask);
+            }
+
+            index -= leadsCount;
+        }
+    }
+
 #endif
 
-inline std::string UTF16ToUTF8(ConstLRef<std::u16string> u16string) {
-    std::string string;
+    for (; position < size; ++position) {
+        if ((StaticCast<U8>(bytes[position]) & 0xC0) != 0x80) {
+            if (index == 0) {
+                return position;
+            }
 
-    return string;
+            --index;
+        }
+    }
+
+    return size;
 }
 
-inline std::u32string UTF16ToUTF32(ConstLRef<std::u16string> u16string) {
-    std::u32string u32string;
+/**
+ * Decoding valid UTF-8 without SIMD
+ * @param bytes Bytes (valid UTF-8)
+ * @param size Bytes count
+ * @param output Output code points
+ * @return Code points count
+ */
+template<typename ByteT, typename CodePointT>
+inline constexpr U64 DecodeValidUTF8Scalar(ConstPtr<ByteT> bytes, ConstLRef<U64> size, Ptr<CodePointT> output) {
+    U64 count = 0;
 
-    return u32string;
+    for (U64 position = 0; position < size; ++count) {
+        U32 byte = StaticCast<U8>(bytes[position]);
+
+        U32 codePoint;
+
+        if (byte < 0x80) {
+            codePoint = byte;
+
+            position += 1;
+        } else if (byte < 0xE0) {
+            codePoint = ((byte & 0x1F) << 6)
+                        | (StaticCast<U8>(bytes[position + 1]) & 0x3F);
+
+            position += 2;
+        } else if (byte < 0xF0) {
+            codePoint = ((byte & 0x0F) << 12)
+                        | ((StaticCast<U8>(bytes[position + 1]) & 0x3F) << 6)
+                        | (StaticCast<U8>(bytes[position + 2]) & 0x3F);
+
+            position += 3;
+        } else {
+            codePoint = ((byte & 0x07) << 18)
+                        | ((StaticCast<U8>(bytes[position + 1]) & 0x3F) << 12)
+                        | ((StaticCast<U8>(bytes[position + 2]) & 0x3F) << 6)
+                        | (StaticCast<U8>(bytes[position + 3]) & 0x3F);
+
+            position += 4;
+        }
+
+        output[count] = StaticCast<CodePointT>(codePoint);
+    }
+
+    return count;
 }
 
-inline std::string UTF32ToUTF8(ConstLRef<std::u32string> u32string) {
-    std::string string;
+#if defined(GS_SIMD_SSE4)
 
-    return string;
+/**
+ * Shuffles for packing kept 32-bit lanes (by 4-bit mask) to start of 128-bit vector
+ */
+inline constexpr auto UTF8DecodePackShuffles = [] {
+    Array<Array<U8, 16>, 16> shuffles;
+
+    for (U64 mask = 0; mask < 16; ++mask) {
+        U64 lane = 0;
+
+        for (U64 index = 0; index < 4; ++index) {
+            if (((mask >> index) & 1) != 0) {
+                for (U64 i = 0; i < 4; ++i) {
+                    shuffles[mask][lane * 4 + i] = StaticCast<U8>(index * 4 + i);
+                }
+
+                ++lane;
+            }
+        }
+
+        for (U64 i = lane * 4; i < 16; ++i) {
+            shuffles[mask][i] = 0x80;
+        }
+    }
+
+    return shuffles;
+}();
+
+/**
+ * Shuffles and sizes for packing UTF-8 bytes of four BMP code points (by 2-bit sizes - 1 of each code point)
+ */
+inline constexpr auto UTF8EncodePackShuffles = [] {
+    Array<Array<U8, 17>, 256> shuffles;
+
+    for (U64 key = 0; key < 256; ++key) {
+        U64 size = 0;
+
+        for (U64 index = 0; index < 4; ++index) {
+            auto symbolSize = ((key >> (index * 2)) & 3) + 1;
+
+            for (U64 i = 0; i < symbolSize && symbolSize < 4; ++i) {
+                shuffles[key][size++] = StaticCast<U8>(index * 4 + i);
+            }
+        }
+
+        for (auto i = size; i < 16; ++i) {
+            shuffles[key][i] = 0x80;
+        }
+
+        shuffles[key][16] = StaticCast<U8>(size);
+    }
+
+    return shuffles;
+}();
+
+/**
+ * Decoding four code points at positions of lead bytes from 16 bytes (valid UTF-8)
+ * @param input 16 bytes starting at first position
+ * @param shuffle Shuffle for collecting 4 bytes starting at each position to 32-bit lanes
+ * @param keepMask Mask of positions with lead bytes (bit for each lane)
+ * @return Code points for each lane (undefined for continuation bytes)
+ */
+inline __m128i DecodeUTF8Lanes(__m128i input, __m128i shuffle, LRef<U32> keepMask) {
+    auto word = _mm_shuffle_epi8(input, shuffle);
+
+    auto byte0 = _mm_and_si128(word, _mm_set1_epi32(0xFF));
+
+    auto byte1 = _mm_and_si128(_mm_srli_epi32(word, 8), _mm_set1_epi32(0x3F));
+
+    auto byte2 = _mm_and_si128(_mm_srli_epi32(word, 16), _mm_set1_epi32(0x3F));
+
+    auto byte3 = _mm_and_si128(_mm_srli_epi32(word, 24), _mm_set1_epi32(0x3F));
+
+    auto codePoint2 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(word, _mm_set1_epi32(0x1F)), 6), byte1);
+
+    auto codePoint3 = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(word, _mm_set1_epi32(0x0F)), 12), _mm_slli_epi32(byte1, 6)), byte2);
+
+    auto codePoint4 = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(word, _mm_set1_epi32(0x07)), 18), _mm_slli_epi32(byte1, 12)),
+                                   _mm_or_si128(_mm_slli_epi32(byte2, 6), byte3));
+
+    auto codePoint = _mm_blendv_epi8(codePoint4, codePoint3, _mm_cmplt_epi32(byte0, _mm_set1_epi32(0xF0)));
+
+    codePoint = _mm_blendv_epi8(codePoint, codePoint2, _mm_cmplt_epi32(byte0, _mm_set1_epi32(0xE0)));
+
+    codePoint = _mm_blendv_epi8(codePoint, byte0, _mm_cmplt_epi32(byte0, _mm_set1_epi32(0x80)));
+
+    auto continuation = _mm_cmpeq_epi32(_mm_and_si128(byte0, _mm_set1_epi32(0xC0)), _mm_set1_epi32(0x80));
+
+    keepMask = ~StaticCast<U32>(_mm_movemask_ps(_mm_castsi128_ps(continuation))) & 0xF;
+
+    return codePoint;
 }
 
-inline std::u16string UTF32ToUTF16(ConstLRef<std::u32string> u32string) {
-    std::u16string u16string;
+#endif
+
+#if defined(GS_SIMD_AVX2)
+
+/**
+ * Permutation indices for packing kept 32-bit lanes (by 8-bit mask) to start of 256-bit vector
+ */
+inline constexpr auto UTF8DecodePackPermutations = [] {
+    Array<U64, 256> permutations;
+
+    for (U64 mask = 0; mask < 256; ++mask) {
+        U64 permutation = 0, lane = 0;
+
+        for (U64 index = 0; index < 8; ++index) {
+            if (((mask >> index) & 1) != 0) {
+                permutation |= index << (lane * 8);
+
+                ++lane;
+            }
+        }
+
+        permutations[mask] = permutation;
+    }
+
+    return permutations;
+}();
+
+#endif
+
+/**
+ * Decoding valid UTF-8 with SIMD (ASCII blocks are widened, other blocks are decoded by positions in parallel)
+ * @param bytes Bytes (valid UTF-8)
+ * @param size Bytes count
+ * @param output Output code points (UTF8 symbols count)
+ * @return Code points count
+ */
+template<typename CodePointT>
+inline U64 DecodeValidUTF8(ConstPtr<U8> bytes, ConstLRef<U64> size, Ptr<CodePointT> output) {
+    static_assert(sizeof(CodePointT) == 4 && std::is_trivially_copyable_v<CodePointT>,
+                  "DecodeValidUTF8(ConstPtr<U8>, ConstLRef<U64>, Ptr<CodePointT>): Code points must be 32-bit trivially copyable type!");
+
+    U64 position = 0, count = 0;
+
+#if defined(GS_SIMD_AVX2)
+
+    auto shuffle = _mm256_setr_epi8(0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6,
+                                    4, 5, 6, 7, 5, 6, 7, 8, 6, 7, 8, 9, 7, 8, 9, 10);
+
+    // output of each step is not bigger than symbols count in 32 bytes
+    while (position + 32 <= size) {
+        auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes + position));
+
+        if (_mm256_movemask_epi8(input) == 0) {
+            for (U64 index = 0; index < 4; ++index) {
+                auto widened = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(bytes + position + index * 8)));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + count + index * 8), widened);
+            }
+
+            position += 32;
+
+            count += 32;
+
+            continue;
+        }
+
+        auto word = _mm256_shuffle_epi8(_mm256_broadcastsi128_si256(_mm256_castsi256_si128(input)), shuffle);
+
+        auto byte0 = _mm256_and_si256(word, _mm256_set1_epi32(0xFF));
+
+        auto byte1 = _mm256_and_si256(_mm256_srli_epi32(word, 8), _mm256_set1_epi32(0x3F));
+
+        auto byte2 = _mm256_and_si256(_mm256_srli_epi32(word, 16), _mm256_set1_epi32(0x3F));
+
+        auto byte3 = _mm256_and_si256(_mm256_srli_epi32(word, 24), _mm256_set1_epi32(0x3F));
+
+        auto codePoint2 = _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(word, _mm256_set1_epi32(0x1F)), 6), byte1);
+
+        auto codePoint3 = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(word, _mm256_set1_epi32(0x0F)), 12), _mm256_slli_epi32(byte1, 6)), byte2);
+
+        auto codePoint4 = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(word, _mm256_set1_epi32(0x07)), 18), _mm256_slli_epi32(byte1, 12)),
+                                          _mm256_or_si256(_mm256_slli_epi32(byte2, 6), byte3));
+
+        auto codePoints = _mm256_blendv_epi8(codePoint4, codePoint3, _mm256_cmpgt_epi32(_mm256_set1_epi32(0xF0), byte0));
+
+        codePoints = _mm256_blendv_epi8(codePoints, codePoint2, _mm256_cmpgt_epi32(_mm256_set1_epi32(0xE0), byte0));
+
+        codePoints = _mm256_blendv_epi8(codePoints, byte0, _mm256_cmpgt_epi32(_mm256_set1_epi32(0x80), byte0));
+
+        auto continuation = _mm256_cmpeq_epi32(_mm256_and_si256(byte0, _mm256_set1_epi32(0xC0)), _mm256_set1_epi32(0x80));
+
+        auto keepMask = ~StaticCast<U32>(_mm256_movemask_ps(_mm256_castsi256_ps(continuation))) & 0xFF;
+
+        auto permutation = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(&UTF8DecodePackPermutations[keepMask])));
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + count), _mm256_permutevar8x32_epi32(codePoints, permutation));
+
+        position += 8;
+
+        count += std::popcount(keepMask);
+    }
+
+#elif defined(GS_SIMD_SSE4)
+
+    auto shuffle = _mm_setr_epi8(0, 1, 2, 3, 1, 2, 3, 4, 2, 3, 4, 5, 3, 4, 5, 6);
+
+    // output of each step is not bigger than symbols count in 16 bytes
+    while (position + 16 <= size) {
+        auto input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + position));
+
+        if (_mm_movemask_epi8(input) == 0) {
+            for (U64 index = 0; index < 4; ++index) {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + count + index * 4), _mm_cvtepu8_epi32(input));
+
+                input = _mm_srli_si128(input, 4);
+            }
+
+            position += 16;
+
+            count += 16;
+
+            continue;
+        }
+
+        U32 keepMask;
+
+        auto codePoints = DecodeUTF8Lanes(input, shuffle, keepMask);
+
+        auto packShuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(UTF8DecodePackShuffles[keepMask].Data()));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + count), _mm_shuffle_epi8(codePoints, packShuffle));
+
+        position += 4;
+
+        count += std::popcount(keepMask);
+    }
+
+#endif
+
+    // skipping rest of symbol decoded in last block
+    while (position < size && (bytes[position] & 0xC0) == 0x80) {
+        ++position;
+    }
+
+    return count + DecodeValidUTF8Scalar(bytes + position, size - position, output + count);
+}
+
+/**
+ * Counting code points for UTF8ToUTF32 (malformed sequences are counted as U+FFFD)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @return Code points count
+ */
+template<typename ByteT>
+inline constexpr U64 UTF8ToUTF32Length(ConstPtr<ByteT> bytes, ConstLRef<U64> size) {
+    U64 length = 0;
+
+    for (U64 position = 0; position < size;) {
+        auto errorPosition = position + FindUTF8Error(bytes + position, size - position);
+
+        length += CountUTF8Symbols(bytes + position, errorPosition - position);
+
+        if (errorPosition == size) {
+            break;
+        }
+
+        U32 codePoint;
+
+        position = errorPosition + FromUTF8(bytes + errorPosition, size - errorPosition, codePoint);
+
+        ++length;
+    }
+
+    return length;
+}
+
+/**
+ * Transcoding UTF-8 to code points (malformed sequences are replaced with U+FFFD)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param output Output code points (at least UTF8ToUTF32Length(bytes, size) code points)
+ * @return Code points count
+ */
+template<typename ByteT, typename CodePointT>
+inline constexpr U64 UTF8ToUTF32(ConstPtr<ByteT> bytes, ConstLRef<U64> size, Ptr<CodePointT> output) {
+    U64 count = 0;
+
+    for (U64 position = 0; position < size;) {
+        auto errorPosition = position + FindUTF8Error(bytes + position, size - position);
+
+        if (std::is_constant_evaluated()) {
+            count += DecodeValidUTF8Scalar(bytes + position, errorPosition - position, output + count);
+        } else {
+            count += DecodeValidUTF8(ReinterpretCast<ConstPtr<U8>>(bytes) + position, errorPosition - position, output + count);
+        }
+
+        if (errorPosition == size) {
+            break;
+        }
+
+        U32 codePoint;
+
+        position = errorPosition + FromUTF8(bytes + errorPosition, size - errorPosition, codePoint);
+
+        output[count++] = StaticCast<CodePointT>(ReplacementCodePoint);
+    }
+
+    return count;
+}
+
+/**
+ * Counting bytes for UTF32ToUTF8 (invalid code points are counted as U+FFFD)
+ * @param codePoints Code points
+ * @param size Code points count
+ * @return Bytes count
+ */
+template<typename CodePointT>
+inline constexpr U64 UTF32ToUTF8Length(ConstPtr<CodePointT> codePoints, ConstLRef<U64> size) {
+    U64 index = 0, length = 0;
+
+#if defined(GS_SIMD_SSE2)
+
+    if constexpr (sizeof(CodePointT) == 4 && std::is_trivially_copyable_v<CodePointT>) {
+        if (!std::is_constant_evaluated()) {
+            auto data = reinterpret_cast<const __m128i *>(codePoints);
+
+            // unsigned comparisons by signed comparisons of biased values
+            auto bias = _mm_set1_epi32(StaticCast<I32>(0x80000000));
+
+            auto isAbove = [bias] (__m128i vector, U32 bound) {
+                return _mm_cmpgt_epi32(vector, _mm_set1_epi32(StaticCast<I32>(bound ^ 0x80000000)));
+            };
+
+            // lane counters are flushed before overflow
+            while (index + 4 <= size) {
+                auto counters = _mm_setzero_si128();
+
+                for (U64 iteration = 0; iteration < 0x10000 && index + 4 <= size; ++iteration, index += 4) {
+                    auto vector = _mm_xor_si128(_mm_loadu_si128(data + index / 4), bias);
+
+                    // surrogates are counted as 3 bytes of U+FFFD, code points above U+10FFFF are counted as 4 - 1
+                    counters = _mm_sub_epi32(counters, _mm_add_epi32(_mm_add_epi32(isAbove(vector, 0x7F), isAbove(vector, 0x7FF)),
+                                                                     _mm_sub_epi32(isAbove(vector, 0xFFFF), isAbove(vector, 0x10FFFF))));
+                }
+
+                U32 lanes[4];
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), counters);
+
+                length += StaticCast<U64>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            }
+
+            length += index;
+        }
+    }
+
+#endif
+
+    for (; index < size; ++index) {
+        auto codePoint = CodePointValue(codePoints[index]);
+
+        length += 1 + (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x10000) - (codePoint > 0x10FFFF);
+    }
+
+    return length;
+}
+
+/**
+ * Encoding code point to UTF-8 (invalid code points are encoded as U+FFFD)
+ * @param codePoint Code point
+ * @param output Output bytes (at least 4 bytes)
+ * @return Bytes count
+ */
+template<typename ByteT>
+inline constexpr U8 EncodeUTF8(U32 codePoint, Ptr<ByteT> output) noexcept {
+    if (codePoint - 0xD800 < 0x800 || codePoint > 0x10FFFF) {
+        codePoint = ReplacementCodePoint;
+    }
+
+    if (codePoint < 0x80) {
+        output[0] = StaticCast<ByteT>(codePoint);
+
+        return 1;
+    }
+
+    if (codePoint < 0x800) {
+        output[0] = StaticCast<ByteT>(0xC0 | (codePoint >> 6));
+        output[1] = StaticCast<ByteT>(0x80 | (codePoint & 0x3F));
+
+        return 2;
+    }
+
+    if (codePoint < 0x10000) {
+        output[0] = StaticCast<ByteT>(0xE0 | (codePoint >> 12));
+        output[1] = StaticCast<ByteT>(0x80 | ((codePoint >> 6) & 0x3F));
+        output[2] = StaticCast<ByteT>(0x80 | (codePoint & 0x3F));
+
+        return 3;
+    }
+
+    output[0] = StaticCast<ByteT>(0xF0 | (codePoint >> 18));
+    output[1] = StaticCast<ByteT>(0x80 | ((codePoint >> 12) & 0x3F));
+    output[2] = StaticCast<ByteT>(0x80 | ((codePoint >> 6) & 0x3F));
+    output[3] = StaticCast<ByteT>(0x80 | (codePoint & 0x3F));
+
+    return 4;
+}
+
+/**
+ * Encoding code point to UTF-8 without allocation (invalid code points are encoded as U+FFFD)
+ * @param codePoint Code point
+ * @param bytes Output bytes
+ * @return Bytes count
+ */
+inline constexpr U8 EncodeUTF8(ConstLRef<U32> codePoint, LRef<Array<U8, 4>> bytes) noexcept {
+    return EncodeUTF8(codePoint, bytes.Data());
+}
+
+/**
+ * Transcoding code points to UTF-8 (invalid code points are replaced with U+FFFD)
+ * @param codePoints Code points
+ * @param size Code points count
+ * @param output Output bytes (at least UTF32ToUTF8Length(codePoints, size) bytes)
+ * @return Bytes count
+ */
+template<typename CodePointT, typename ByteT>
+inline constexpr U64 UTF32ToUTF8(ConstPtr<CodePointT> codePoints, ConstLRef<U64> size, Ptr<ByteT> output) {
+    U64 position = 0, count = 0;
+
+#if defined(GS_SIMD_SSE4)
+
+    if constexpr (sizeof(CodePointT) == 4 && std::is_trivially_copyable_v<CodePointT>) {
+        if (!std::is_constant_evaluated()) {
+            auto data = reinterpret_cast<const __m128i *>(codePoints);
+
+            auto bytes = ReinterpretCast<Ptr<U8>>(output);
+
+            // output of each step is not bigger than bytes count of 16 code points
+            while (position + 16 <= size) {
+                auto input0 = _mm_loadu_si128(data + position / 4);
+
+                auto input1 = _mm_loadu_si128(data + position / 4 + 1);
+
+                auto input2 = _mm_loadu_si128(data + position / 4 + 2);
+
+                auto input3 = _mm_loadu_si128(data + position / 4 + 3);
+
+                auto nonASCII = _mm_set1_epi32(StaticCast<I32>(0xFFFFFF80));
+
+                if (_mm_testz_si128(_mm_or_si128(_mm_or_si128(input0, input1), _mm_or_si128(input2, input3)), nonASCII)) {
+                    auto packed = _mm_packus_epi16(_mm_packus_epi32(input0, input1), _mm_packus_epi32(input2, input3));
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(bytes + count), packed);
+
+                    position += 16;
+
+                    count += 16;
+
+                    continue;
+                }
+
+                auto isSurrogate = _mm_cmpeq_epi32(_mm_and_si128(input0, _mm_set1_epi32(StaticCast<I32>(0xFFFFF800))), _mm_set1_epi32(0xD800));
+
+                auto isSupplementary = _mm_and_si128(input0, _mm_set1_epi32(StaticCast<I32>(0xFFFF0000)));
+
+                if (!_mm_testz_si128(_mm_or_si128(isSurrogate, isSupplementary), _mm_set1_epi32(-1))) {
+                    for (auto end = position + 4; position < end; ++position) {
+                        count += EncodeUTF8(CodePointValue(codePoints[position]), bytes + count);
+                    }
+
+                    continue;
+                }
+
+                // four BMP code points
+                auto isSize1 = _mm_cmplt_epi32(input0, _mm_set1_epi32(0x80));
+
+                auto isSize2OrLess = _mm_cmplt_epi32(input0, _mm_set1_epi32(0x800));
+
+                auto continuation0 = _mm_or_si128(_mm_and_si128(input0, _mm_set1_epi32(0x3F)), _mm_set1_epi32(0x80));
+
+                auto continuation1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(input0, 6), _mm_set1_epi32(0x3F)), _mm_set1_epi32(0x80));
+
+                auto encoded2 = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(input0, 6), _mm_set1_epi32(0xC0)), _mm_slli_epi32(continuation0, 8));
+
+                auto encoded3 = _mm_or_si128(_mm_or_si128(_mm_srli_epi32(input0, 12), _mm_set1_epi32(0xE0)),
+                                             _mm_or_si128(_mm_slli_epi32(continuation1, 8), _mm_slli_epi32(continuation0, 16)));
+
+                auto encoded = _mm_blendv_epi8(_mm_blendv_epi8(encoded3, encoded2, isSize2OrLess), input0, isSize1);
+
+                // sizes - 1 of code points in lanes packed to byte
+                auto sizes = _mm_add_epi32(_mm_add_epi32(_mm_set1_epi32(2), isSize1), isSize2OrLess);
+
+                auto sizesBytes = StaticCast<U32>(_mm_cvtsi128_si32(_mm_packus_epi16(_mm_packus_epi32(sizes, sizes), sizes)));
+
+                auto key = (sizesBytes & 0x3) | ((sizesBytes >> 6) & 0xC) | ((sizesBytes >> 12) & 0x30) | ((sizesBytes >> 18) & 0xC0);
+
+                auto &packShuffle = UTF8EncodePackShuffles[key];
+
+                auto packed = _mm_shuffle_epi8(encoded, _mm_loadu_si128(reinterpret_cast<const __m128i *>(packShuffle.Data())));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(bytes + count), packed);
+
+                position += 4;
+
+                count += packShuffle[16];
+            }
+        }
+    }
+
+#endif
+
+    for (; position < size; ++position) {
+        count += EncodeUTF8(CodePointValue(codePoints[position]), output + count);
+    }
+
+    return count;
+}
+
+/**
+ * Reading UTF-16 code unit stored in byte order
+ * @tparam ByteOrderV Byte order of code units
+ * @param units Code units
+ * @param index Index
+ * @return Code unit
+ */
+template<std::endian ByteOrderV = std::endian::native, typename UnitT>
+inline constexpr U32 LoadUTF16Unit(ConstPtr<UnitT> units, ConstLRef<U64> index) {
+    static_assert(sizeof(UnitT) == 2, "LoadUTF16Unit(ConstPtr<UnitT>, ConstLRef<U64>): Code units must be 16-bit type!");
+
+    auto unit = StaticCast<U16>(units[index]);
+
+    if constexpr (ByteOrderV != std::endian::native) {
+        unit = StaticCast<U16>((unit >> 8) | (unit << 8));
+    }
+
+    return unit;
+}
+
+template<std::endian ByteOrderV = std::endian::native, typename UnitT>
+inline constexpr Void StoreUTF16Unit(Ptr<UnitT> units, ConstLRef<U64> index, U32 unit) {
+    if constexpr (ByteOrderV != std::endian::native) {
+        unit = ((unit >> 8) | (unit << 8)) & 0xFFFF;
+    }
+
+    units[index] = StaticCast<UnitT>(unit);
+}
+
+inline constexpr Bool IsHighSurrogate(ConstLRef<U32> unit) {
+    return unit - 0xD800 < 0x400;
+}
+
+inline constexpr Bool IsLowSurrogate(ConstLRef<U32> unit) {
+    return unit - 0xDC00 < 0x400;
+}
+
+/**
+ * Decoding one code point from UTF-16 (unpaired surrogates are decoded as InvalidCodePoint)
+ * @tparam ByteOrderV Byte order of code units
+ * @param units Code units
+ * @param size Code units count (must be greater than 0)
+ * @param codePoint Decoded code point
+ * @return Code units count of code point
+ */
+template<std::endian ByteOrderV = std::endian::native, typename UnitT>
+inline constexpr U8 FromUTF16(ConstPtr<UnitT> units, ConstLRef<U64> size, LRef<U32> codePoint) noexcept {
+    auto unit = LoadUTF16Unit<ByteOrderV>(units, 0);
+
+    if (unit - 0xD800 >= 0x800) {
+        codePoint = unit;
+
+        return 1;
+    }
+
+    if (IsHighSurrogate(unit) && size > 1) {
+        auto nextUnit = LoadUTF16Unit<ByteOrderV>(units, 1);
+
+        if (IsLowSurrogate(nextUnit)) {
+            codePoint = 0x10000 + ((unit - 0xD800) << 10) + (nextUnit - 0xDC00);
+
+            return 2;
+        }
+    }
+
+    codePoint = InvalidCodePoint;
+
+    return 1;
+}
+
+/**
+ * Encoding code point to UTF-16 (invalid code points are encoded as U+FFFD)
+ * @tparam ByteOrderV Byte order of code units
+ * @param codePoint Code point
+ * @param output Output code units (at least 2 code units)
+ * @return Code units count
+ */
+template<std::endian ByteOrderV = std::endian::native, typename UnitT>
+inline constexpr U8 EncodeUTF16(U32 codePoint, Ptr<UnitT> output) noexcept {
+    if (codePoint - 0xD800 < 0x800 || codePoint > 0x10FFFF) {
+        codePoint = ReplacementCodePoint;
+    }
+
+    if (codePoint < 0x10000) {
+        StoreUTF16Unit<ByteOrderV>(output, 0, codePoint);
+
+        return 1;
+    }
+
+    StoreUTF16Unit<ByteOrderV>(output, 0, 0xD800 + ((codePoint - 0x10000) >> 10));
+
+    StoreUTF16Unit<ByteOrderV>(output, 1, 0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+
+    return 2;
+}
+
+/**
+ * Encoding code point to UTF-16 without allocation (invalid code points are encoded as U+FFFD)
+ * @tparam ByteOrderV Byte order of code units
+ * @param codePoint Code point
+ * @param units Output code units
+ * @return Code units count
+ */
+template<std::endian ByteOrderV = std::endian::native>
+inline constexpr U8 EncodeUTF16(ConstLRef<U32> codePoint, LRef<Array<U16, 2>> units) noexcept {
+    return EncodeUTF16<ByteOrderV>(codePoint, units.Data());
+}
+
+#if defined(GS_SIMD_SSE2)
+
+/**
+ * Loading 8 UTF-16 code units in native byte order
+ */
+template<std::endian ByteOrderV, typename UnitT>
+inline __m128i LoadUTF16Vector(ConstPtr<UnitT> units) {
+    auto vector = _mm_loadu_si128(reinterpret_cast<const __m128i *>(units));
+
+    if constexpr (ByteOrderV != std::endian::native) {
+        vector = _mm_or_si128(_mm_slli_epi16(vector, 8), _mm_srli_epi16(vector, 8));
+    }
+
+    return vector;
+}
+
+template<std::endian ByteOrderV, typename UnitT>
+inline Void StoreUTF16Vector(Ptr<UnitT> units, __m128i vector) {
+    if constexpr (ByteOrderV != std::endian::native) {
+        vector = _mm_or_si128(_mm_slli_epi16(vector, 8), _mm_srli_epi16(vector, 8));
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(units), vector);
+}
+
+inline Bool HasSurrogates(__m128i units) {
+    auto surrogates = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(StaticCast<I16>(0xF800))), _mm_set1_epi16(StaticCast<I16>(0xD800)));
+
+    return _mm_movemask_epi8(surrogates) != 0;
+}
+
+#endif
+
+/**
+ * Finding first unpaired surrogate in UTF-16
+ * @tparam ByteOrderV Byte order of code units
+ * @param units Code units
+ * @param size Code units count
+ * @return Position of first unpaired surrogate or code units count for valid UTF-16
+ */
+template<std::endian ByteOrderV = std::endian::native, typename UnitT>
+inline constexpr U64 FindUTF16Error(ConstPtr<UnitT> units, ConstLRef<U64> size) {
+    for (U64 position = 0; position < size;) {
+
+#if defined(GS_SIMD_SSE2)
+
+        if (!std::is_constant_evaluated() && position + 8 <= size && !HasSurrogates(LoadUTF16Vector<ByteOrderV>(units + position))) {
+            position += 8;
+
+            continue;
+        }
+
+#endif
+
+        U32 codePoint;
+
+        auto unitsCount = FromUTF16<ByteOrderV>(units + position, size - position, codePoint);
+
+        if (codePoint == InvalidCodePoint) {
+            return position;
+        }
+
+        position += unitsCount;
+    }
+
+    return size;
+}
+
+template<std::endian ByteOrderV = std::endian::native, typename UnitT>
+inline constexpr Bool IsValidUTF16(ConstPtr<UnitT> units, ConstLRef<U64> size) {
+    return FindUTF16Error<ByteOrderV>(units, size) == size;
+}
+
+/**
+ * Counting code points for UTF16ToUTF32 (unpaired surrogates are counted as U+FFFD)
+ * @tparam ByteOrderV Byte order of code units
+ * @param units Code units
+ * @param size Code units count
+ * @return Code points count
+ */
+template<std::endian ByteOrderV = std::endian::native, typename UnitT>
+inline constexpr U64 UTF16ToUTF32Length(ConstPtr<UnitT> units, ConstLRef<U64> size) {
+    U64 length = 0;
+
+    for (U64 position = 0; position < size; ++length) {
+
+#if defined(GS_SIMD_SSE2)
+
+        if (!std::is_constant_evaluated() && position + 8 <= size && !HasSurrogates(LoadUTF16Vector<ByteOrderV>(units + position))) {
+            position += 8;
+
+            length += 7;
+
+            continue;
+        }
+
+#endif
+
+        auto pairSize = IsHighSurrogate(LoadUTF16Unit<ByteOrderV>(units, position))
+                        && position + 1 < size
+                        && IsLowSurrogate(LoadUTF16Unit<ByteOrderV>(units, position + 1));
+
+        position += 1 + pairSize;
+    }
+
+    return length;
+}
+
+/**
+ * Transcoding UTF-16 to code points (unpaired surrogates are replaced with U+FFFD)
+ * @tparam ByteOrderV Byte order of code units
+ * @param units Code units
+ * @param size Code units count
+ * @param output Output code points (at least UTF16ToUTF32Length(units, size) code points)
+ * @return Code points count
+ */
+template<std::endian ByteOrderV = std::endian::native, typename UnitT, typename CodePointT>
+inline constexpr U64 UTF16ToUTF32(ConstPtr<UnitT> units, ConstLRef<U64> size, Ptr<CodePointT> output) {
+    U64 position = 0, count = 0;
+
+#if defined(GS_SIMD_SSE2)
+
+    if constexpr (sizeof(CodePointT) == 4 && std::is_trivially_copyable_v<CodePointT>) {
+        if (!std::is_constant_evaluated()) {
+            while (position + 8 <= size) {
+                auto vector = LoadUTF16Vector<ByteOrderV>(units + position);
+
+                if (HasSurrogates(vector)) {
+                    // decoding up to end of block, last surrogate pair can end in next block
+                    for (auto end = position + 8; position < end; ++count) {
+                        U32 codePoint;
+
+                        position += FromUTF16<ByteOrderV>(units + position, size - position, codePoint);
+
+                        output[count] = StaticCast<CodePointT>(codePoint == InvalidCodePoint ? ReplacementCodePoint : codePoint);
+                    }
+
+                    continue;
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + count), _mm_unpacklo_epi16(vector, _mm_setzero_si128()));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + count + 4), _mm_unpackhi_epi16(vector, _mm_setzero_si128()));
+
+                position += 8;
+
+                count += 8;
+            }
+        }
+    }
+
+#endif
+
+    while (position < size) {
+        U32 codePoint;
+
+        position += FromUTF16<ByteOrderV>(units + position, size - position, codePoint);
+
+        output[count++] = StaticCast<CodePointT>(codePoint == InvalidCodePoint ? ReplacementCodePoint : codePoint);
+    }
+
+    return count;
+}
+
+/**
+ * Counting code units for UTF32ToUTF16 (invalid code points are counted as U+FFFD)
+ * @param codePoints Code points
+ * @param size Code points count
+ * @return Code units count
+ */
+template<typename CodePointT>
+inline constexpr U64 UTF32ToUTF16Length(ConstPtr<CodePointT> codePoints, ConstLRef<U64> size) {
+    U64 index = 0, length = size;
+
+#if defined(GS_SIMD_SSE2)
+
+    if constexpr (sizeof(CodePointT) == 4 && std::is_trivially_copyable_v<CodePointT>) {
+        if (!std::is_constant_evaluated()) {
+            auto data = reinterpret_cast<const __m128i *>(codePoints);
+
+            // (code point - 0x10000) < 0x100000 as signed comparison of biased values
+            auto bias = _mm_set1_epi32(StaticCast<I32>(0x80000000 - 0x10000));
+
+            auto bound = _mm_set1_epi32(StaticCast<I32>(0x80000000 + 0x100000));
+
+            while (index + 4 <= size) {
+                auto counters = _mm_setzero_si128();
+
+                for (U64 iteration = 0; iteration < 0x10000 && index + 4 <= size; ++iteration, index += 4) {
+                    auto vector = _mm_add_epi32(_mm_loadu_si128(data + index / 4), bias);
+
+                    counters = _mm_sub_epi32(counters, _mm_cmplt_epi32(vector, bound));
+                }
+
+                U32 lanes[4];
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), counters);
+
+                length += StaticCast<U64>(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+            }
+        }
+    }
+
+#endif
+
+    for (; index < size; ++index) {
+        length += CodePointValue(codePoints[index]) - 0x10000 < 0x100000;
+    }
+
+    return length;
+}
+
+/**
+ * Transcoding code points to UTF-16 (invalid code points are replaced with U+FFFD)
+ * @tparam ByteOrderV Byte order of code units
+ * @param codePoints Code points
+ * @param size Code points count
+ * @param output Output code units (at least UTF32ToUTF16Length(codePoints, size) code units)
+ * @return Code units count
+ */
+template<std::endian ByteOrderV = std::endian::native, typename CodePointT, typename UnitT>
+inline constexpr U64 UTF32ToUTF16(ConstPtr<CodePointT> codePoints, ConstLRef<U64> size, Ptr<UnitT> output) {
+    U64 position = 0, count = 0;
+
+#if defined(GS_SIMD_SSE2)
+
+    if constexpr (sizeof(CodePointT) == 4 && std::is_trivially_copyable_v<CodePointT>) {
+        if (!std::is_constant_evaluated()) {
+            auto data = reinterpret_cast<const __m128i *>(codePoints);
+
+            while (position + 8 <= size) {
+                auto low = _mm_loadu_si128(data + position / 4);
+
+                auto high = _mm_loadu_si128(data + position / 4 + 1);
+
+                // code points above U+FFFF or surrogates
+                auto outside = _mm_or_si128(_mm_and_si128(_mm_or_si128(low, high), _mm_set1_epi32(StaticCast<I32>(0xFFFF0000))),
+                                            _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(low, _mm_set1_epi32(0xF800)), _mm_set1_epi32(0xD800)),
+                                                         _mm_cmpeq_epi32(_mm_and_si128(high, _mm_set1_epi32(0xF800)), _mm_set1_epi32(0xD800))));
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(outside, _mm_setzero_si128())) != 0xFFFF) {
+                    for (auto end = position + 8; position < end; ++position) {
+                        count += EncodeUTF16<ByteOrderV>(CodePointValue(codePoints[position]), output + count);
+                    }
+
+                    continue;
+                }
+
+                // signed saturating pack of biased values keeps all 16 bits
+                auto bias = _mm_set1_epi32(0x8000);
+
+                auto packed = _mm_add_epi16(_mm_packs_epi32(_mm_sub_epi32(low, bias), _mm_sub_epi32(high, bias)), _mm_set1_epi16(StaticCast<I16>(0x8000)));
+
+                StoreUTF16Vector<ByteOrderV>(output + count, packed);
+
+                position += 8;
+
+                count += 8;
+            }
+        }
+    }
+
+#endif
+
+    for (; position < size; ++position) {
+        count += EncodeUTF16<ByteOrderV>(CodePointValue(codePoints[position]), output + count);
+    }
+
+    return count;
+}
+
+/**
+ * Counting code units for UTF8ToUTF16 (malformed sequences are counted as U+FFFD)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @return Code units count
+ */
+template<typename ByteT>
+inline constexpr U64 UTF8ToUTF16Length(ConstPtr<ByteT> bytes, ConstLRef<U64> size) {
+    U64 length = 0;
+
+    for (U64 position = 0; position < size;) {
+        auto errorPosition = position + FindUTF8Error(bytes + position, size - position);
+
+        // each 4 bytes sequence is encoded with surrogate pair
+        length += CountUTF8Symbols(bytes + position, errorPosition - position)
+                  + CountBytesInRange(bytes + position, errorPosition - position, 0xF0, 0xFF);
+
+        if (errorPosition == size) {
+            break;
+        }
+
+        U32 codePoint;
+
+        position = errorPosition + FromUTF8(bytes + errorPosition, size - errorPosition, codePoint);
+
+        ++length;
+    }
+
+    return length;
+}
+
+/**
+ * Code points buffer size for transcoding between UTF-8 and UTF-16 through UTF-32
+ */
+inline constexpr U64 UTF16TranscodeBlockSize = 256;
+
+/**
+ * Transcoding UTF-8 to UTF-16 (malformed sequences are replaced with U+FFFD)
+ * @tparam ByteOrderV Byte order of code units
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param output Output code units (at least UTF8ToUTF16Length(bytes, size) code units)
+ * @return Code units count
+ */
+template<std::endian ByteOrderV = std::endian::native, typename ByteT, typename UnitT>
+inline constexpr U64 UTF8ToUTF16(ConstPtr<ByteT> bytes, ConstLRef<U64> size, Ptr<UnitT> output) {
+    U32 codePoints[UTF16TranscodeBlockSize];
+
+    U64 count = 0;
+
+    for (U64 position = 0; position < size;) {
+        auto end = size - position > UTF16TranscodeBlockSize ? position + UTF16TranscodeBlockSize : size;
+
+        // splitting blocks before sequence, which continues in next block
+        for (U64 index = 1; index <= 3 && end < size; ++index) {
+            auto byte = StaticCast<U8>(bytes[end - index]);
+
+            if ((byte & 0xC0) != 0x80) {
+                if (byte >= 0xC0 && UTF8Size(byte) > index) {
+                    end -= index;
+                }
+
+                break;
+            }
+        }
+
+        auto codePointsCount = UTF8ToUTF32(bytes + position, end - position, codePoints);
+
+        count += UTF32ToUTF16<ByteOrderV>(StaticCast<ConstPtr<U32>>(codePoints), codePointsCount, output + count);
+
+        position = end;
+    }
+
+    return count;
+}
+
+/**
+ * Counting bytes for UTF16ToUTF8 (unpaired surrogates are counted as U+FFFD)
+ * @tparam ByteOrderV Byte order of code units
+ * @param units Code units
+ * @param size Code units count
+ * @return Bytes count
+ */
+template<std::endian ByteOrderV = std::endian::native, typename UnitT>
+inline constexpr U64 UTF16ToUTF8Length(ConstPtr<UnitT> units, ConstLRef<U64> size) {
+    U64 length = 0;
+
+    for (U64 position = 0; position < size;) {
+
+#if defined(GS_SIMD_SSE2)
+
+        if (!std::is_constant_evaluated() && position + 8 <= size) {
+            auto vector = LoadUTF16Vector<ByteOrderV>(units + position);
+
+            if (!HasSurrogates(vector)) {
+                auto above1 = _mm_cmpeq_epi16(_mm_and_si128(vector, _mm_set1_epi16(StaticCast<I16>(0xFF80))), _mm_setzero_si128());
+
+                auto above2 = _mm_cmpeq_epi16(_mm_and_si128(vector, _mm_set1_epi16(StaticCast<I16>(0xF800))), _mm_setzero_si128());
+
+                // 2 mask bits for each code unit
+                length += 24 - (std::popcount(StaticCast<U32>(_mm_movemask_epi8(above1)))
+                                + std::popcount(StaticCast<U32>(_mm_movemask_epi8(above2)))) / 2;
+
+                position += 8;
+
+                continue;
+            }
+        }
+
+#endif
+
+        U32 codePoint;
+
+        position += FromUTF16<ByteOrderV>(units + position, size - position, codePoint);
+
+        length += codePoint == InvalidCodePoint ? 3 : UTF8Size(codePoint);
+    }
+
+    return length;
+}
+
+/**
+ * Transcoding UTF-16 to UTF-8 (unpaired surrogates are replaced with U+FFFD)
+ * @tparam ByteOrderV Byte order of code units
+ * @param units Code units
+ * @param size Code units count
+ * @param output Output bytes (at least UTF16ToUTF8Length(units, size) bytes)
+ * @return Bytes count
+ */
+template<std::endian ByteOrderV = std::endian::native, typename UnitT, typename ByteT>
+inline constexpr U64 UTF16ToUTF8(ConstPtr<UnitT> units, ConstLRef<U64> size, Ptr<ByteT> output) {
+    U32 codePoints[UTF16TranscodeBlockSize];
+
+    U64 count = 0;
+
+    for (U64 position = 0; position < size;) {
+        auto end = size - position > UTF16TranscodeBlockSize ? position + UTF16TranscodeBlockSize : size;
+
+        // keeping surrogate pair in one block
+        if (end < size && IsHighSurrogate(LoadUTF16Unit<ByteOrderV>(units, end - 1))) {
+            --end;
+        }
+
+        auto codePointsCount = UTF16ToUTF32<ByteOrderV>(units + position, end - position, codePoints);
+
+        count += UTF32ToUTF8(StaticCast<ConstPtr<U32>>(codePoints), codePointsCount, output + count);
+
+        position = end;
+    }
+
+    return count;
+}
+
+/**
+ * Encoding code point to UTF-16 big endian bytes
+ * @param codePoint Code point
+ * @return Bytes
+ */
+inline constexpr Vector<U8> ToUTF16(ConstLRef<U32> codePoint) {
+    Vector<U8> bytes;
+
+    U16 units[2];
+
+    auto unitsCount = EncodeUTF16(codePoint, units);
+
+    for (U64 index = 0; index < unitsCount; ++index) {
+        bytes.Append(StaticCast<U8>(units[index] >> 8));
+        bytes.Append(StaticCast<U8>(units[index] & 0xFF));
+    }
+
+    return bytes;
+}
+
+/**
+ * Decoding code point from UTF-16 big endian bytes
+ * @param bytes Bytes
+ * @return Code point or InvalidCodePoint
+ */
+inline constexpr U32 FromUTF16(ConstLRef<Vector<U8>> bytes) {
+    auto codePoint = InvalidCodePoint;
+
+    U16 units[2];
+
+    U64 unitsCount = 0;
+
+    for (; unitsCount < 2 && unitsCount * 2 + 1 < bytes.Size(); ++unitsCount) {
+        units[unitsCount] = StaticCast<U16>((bytes[unitsCount * 2] << 8) | bytes[unitsCount * 2 + 1]);
+    }
+
+    if (unitsCount > 0) {
+        FromUTF16(StaticCast<ConstPtr<U16>>(units), unitsCount, codePoint);
+    }
+
+    return codePoint;
+}
+
+/**
+ * Text encodings for BOM sniffing, detection and legacy single-byte codecs
+ */
+enum class TextEncoding : U8 {
+    Unknown,
+    UTF8,
+    UTF16LE,
+    UTF16BE,
+    UTF32LE,
+    UTF32BE,
+    Latin1,
+    Windows1251,
+    KOI8R,
+    CP866
+};
+
+inline constexpr Bool IsLegacyEncoding(TextEncoding encoding) {
+    return encoding == TextEncoding::Latin1
+           || encoding == TextEncoding::Windows1251
+           || encoding == TextEncoding::KOI8R
+           || encoding == TextEncoding::CP866;
+}
+
+/**
+ * Code points of bytes 0x80..0xFF in legacy encodings (U+FFFD for unassigned bytes)
+ */
+inline constexpr Array<U16, 128> Windows1251HighCodePoints = {
+    0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+    0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0xFFFD, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+    0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7,
+    0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+    0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7,
+    0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+    0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+    0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F
+};
+
+inline constexpr Array<U16, 128> KOI8RHighCodePoints = {
+    0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524,
+    0x252C, 0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x258C, 0x2590,
+    0x2591, 0x2592, 0x2593, 0x2320, 0x25A0, 0x2219, 0x221A, 0x2248,
+    0x2264, 0x2265, 0x00A0, 0x2321, 0x00B0, 0x00B2, 0x00B7, 0x00F7,
+    0x2550, 0x2551, 0x2552, 0x0451, 0x2553, 0x2554, 0x2555, 0x2556,
+    0x2557, 0x2558, 0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E,
+    0x255F, 0x2560, 0x2561, 0x0401, 0x2562, 0x2563, 0x2564, 0x2565,
+    0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x256B, 0x256C, 0x00A9,
+    0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+    0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+    0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+    0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A,
+    0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+    0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+    0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+    0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A
+};
+
+inline constexpr Array<U16, 128> CP866HighCodePoints = {
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+    0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+    0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+    0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+    0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+    0x0401, 0x0451, 0x0404, 0x0454, 0x0407, 0x0457, 0x040E, 0x045E,
+    0x00B0, 0x2219, 0x00B7, 0x221A, 0x2116, 0x00A4, 0x25A0, 0x00A0
+};
+
+inline constexpr Array<U16, 128> Latin1HighCodePoints = [] {
+    Array<U16, 128> codePoints;
+
+    for (U64 index = 0; index < 128; ++index) {
+        codePoints[index] = StaticCast<U16>(0x80 + index);
+    }
+
+    return codePoints;
+}();
+
+inline constexpr Array<U16, 256> MakeLegacyDecodeTable(ConstLRef<Array<U16, 128>> highCodePoints) {
+    Array<U16, 256> table;
+
+    for (U64 byte = 0; byte < 256; ++byte) {
+        table[byte] = byte < 0x80 ? StaticCast<U16>(byte) : highCodePoints[byte - 0x80];
+    }
+
+    return table;
+}
+
+/**
+ * Making reverse table of legacy encoding, sorted entries (code point << 8 | byte) for bytes 0x80..0xFF
+ */
+inline constexpr Array<U32, 128> MakeLegacyEncodeTable(ConstLRef<Array<U16, 128>> highCodePoints) {
+    Array<U32, 128> table;
+
+    for (U64 index = 0; index < 128; ++index) {
+        U32 codePoint = highCodePoints[index];
+
+        // unassigned bytes are never found
+        table[index] = codePoint == ReplacementCodePoint ? ~0U : (codePoint << 8) | StaticCast<U32>(0x80 + index);
+    }
+
+    for (U64 index = 1; index < 128; ++index) {
+        auto entry = table[index];
+
+        auto position = index;
+
+        for (; position > 0 && table[position - 1] > entry; --position) {
+            table[position] = table[position - 1];
+        }
+
+        table[position] = entry;
+    }
+
+    return table;
+}
+
+inline constexpr Array<U16, 256> Latin1DecodeTable = MakeLegacyDecodeTable(Latin1HighCodePoints);
+
+inline constexpr Array<U16, 256> Windows1251DecodeTable = MakeLegacyDecodeTable(Windows1251HighCodePoints);
+
+inline constexpr Array<U16, 256> KOI8RDecodeTable = MakeLegacyDecodeTable(KOI8RHighCodePoints);
+
+inline constexpr Array<U16, 256> CP866DecodeTable = MakeLegacyDecodeTable(CP866HighCodePoints);
+
+inline constexpr Array<U32, 128> Windows1251EncodeTable = MakeLegacyEncodeTable(Windows1251HighCodePoints);
+
+inline constexpr Array<U32, 128> KOI8REncodeTable = MakeLegacyEncodeTable(KOI8RHighCodePoints);
+
+inline constexpr Array<U32, 128> CP866EncodeTable = MakeLegacyEncodeTable(CP866HighCodePoints);
+
+inline constexpr ConstPtr<U16> LegacyDecodeTable(TextEncoding encoding) {
+    switch (encoding) {
+        case TextEncoding::Latin1:
+            return Latin1DecodeTable.Data();
+        case TextEncoding::Windows1251:
+            return Windows1251DecodeTable.Data();
+        case TextEncoding::KOI8R:
+            return KOI8RDecodeTable.Data();
+        case TextEncoding::CP866:
+            return CP866DecodeTable.Data();
+        default:
+            throw std::runtime_error("LegacyDecodeTable(TextEncoding): Encoding is not legacy encoding!");
+    }
+}
+
+/**
+ * Encoding code point to legacy encoding
+ * @param codePoint Code point
+ * @param encoding Legacy encoding
+ * @param substitute Byte for code points, which can not be encoded
+ * @return Byte
+ */
+inline constexpr U8 EncodeLegacy(ConstLRef<U32> codePoint, TextEncoding encoding, U8 substitute = '?') {
+    if (codePoint < 0x80) {
+        return StaticCast<U8>(codePoint);
+    }
+
+    ConstPtr<U32> table;
+
+    switch (encoding) {
+        case TextEncoding::Latin1:
+            return codePoint < 0x100 ? StaticCast<U8>(codePoint) : substitute;
+        case TextEncoding::Windows1251:
+            table = Windows1251EncodeTable.Data();
+
+            break;
+        case TextEncoding::KOI8R:
+            table = KOI8REncodeTable.Data();
+
+            break;
+        case TextEncoding::CP866:
+            table = CP866EncodeTable.Data();
+
+            break;
+        default:
+            throw std::runtime_error("EncodeLegacy(ConstLRef<U32>, TextEncoding, U8): Encoding is not legacy encoding!");
+    }
+
+    if (codePoint > 0xFFFF) {
+        return substitute;
+    }
+
+    auto key = codePoint << 8;
+
+    U64 lower = 0, upper = 128;
+
+    while (lower < upper) {
+        auto middle = (lower + upper) / 2;
+
+        if (table[middle] < key) {
+            lower = middle + 1;
+        } else {
+            upper = middle;
+        }
+    }
+
+    return lower < 128 && (table[lower] >> 8) == codePoint ? StaticCast<U8>(table[lower] & 0xFF) : substitute;
+}
+
+/**
+ * Transcoding legacy encoding to code points (one code point for each byte)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param encoding Legacy encoding
+ * @param output Output code points (at least size code points)
+ * @return Code points count
+ */
+template<typename ByteT, typename CodePointT>
+inline constexpr U64 LegacyToUTF32(ConstPtr<ByteT> bytes, ConstLRef<U64> size, TextEncoding encoding, Ptr<CodePointT> output) {
+    auto table = LegacyDecodeTable(encoding);
+
+    U64 position = 0;
+
+#if defined(GS_SIMD_SSE2)
+
+    if constexpr (sizeof(CodePointT) == 4 && std::is_trivially_copyable_v<CodePointT>) {
+        if (!std::is_constant_evaluated()) {
+            auto isLatin1 = encoding == TextEncoding::Latin1;
+
+            for (; position + 16 <= size; position += 16) {
+                auto vector = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes + position));
+
+                // ASCII passes through, Latin-1 bytes are code points
+                if (!isLatin1 && _mm_movemask_epi8(vector) != 0) {
+                    for (U64 index = 0; index < 16; ++index) {
+                        output[position + index] = StaticCast<CodePointT>(StaticCast<U32>(table[StaticCast<U8>(bytes[position + index])]));
+                    }
+
+                    continue;
+                }
+
+                auto low = _mm_unpacklo_epi8(vector, _mm_setzero_si128());
+
+                auto high = _mm_unpackhi_epi8(vector, _mm_setzero_si128());
+
+                auto data = reinterpret_cast<__m128i *>(output + position);
+
+                _mm_storeu_si128(data, _mm_unpacklo_epi16(low, _mm_setzero_si128()));
+
+                _mm_storeu_si128(data + 1, _mm_unpackhi_epi16(low, _mm_setzero_si128()));
+
+                _mm_storeu_si128(data + 2, _mm_unpacklo_epi16(high, _mm_setzero_si128()));
+
+                _mm_storeu_si128(data + 3, _mm_unpackhi_epi16(high, _mm_setzero_si128()));
+            }
+        }
+    }
+
+#endif
+
+    for (; position < size; ++position) {
+        output[position] = StaticCast<CodePointT>(StaticCast<U32>(table[StaticCast<U8>(bytes[position])]));
+    }
+
+    return size;
+}
+
+/**
+ * Transcoding code points to legacy encoding (one byte for each code point)
+ * @param codePoints Code points
+ * @param size Code points count
+ * @param encoding Legacy encoding
+ * @param output Output bytes (at least size bytes)
+ * @param substitute Byte for code points, which can not be encoded
+ * @return Bytes count
+ */
+template<typename CodePointT, typename ByteT>
+inline constexpr U64 UTF32ToLegacy(ConstPtr<CodePointT> codePoints, ConstLRef<U64> size, TextEncoding encoding, Ptr<ByteT> output, U8 substitute = '?') {
+    U64 position = 0;
+
+#if defined(GS_SIMD_SSE2)
+
+    if constexpr (sizeof(CodePointT) == 4 && std::is_trivially_copyable_v<CodePointT>) {
+        if (!std::is_constant_evaluated()) {
+            auto data = reinterpret_cast<const __m128i *>(codePoints);
+
+            for (; position + 16 <= size; position += 16) {
+                auto vector0 = _mm_loadu_si128(data + position / 4);
+
+                auto vector1 = _mm_loadu_si128(data + position / 4 + 1);
+
+                auto vector2 = _mm_loadu_si128(data + position / 4 + 2);
+
+                auto vector3 = _mm_loadu_si128(data + position / 4 + 3);
+
+                auto nonASCII = _mm_and_si128(_mm_or_si128(_mm_or_si128(vector0, vector1), _mm_or_si128(vector2, vector3)),
+                                              _mm_set1_epi32(StaticCast<I32>(0xFFFFFF80)));
+
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(nonASCII, _mm_setzero_si128())) != 0xFFFF) {
+                    for (U64 index = 0; index < 16; ++index) {
+                        output[position + index] = StaticCast<ByteT>(EncodeLegacy(CodePointValue(codePoints[position + index]), encoding, substitute));
+                    }
+
+                    continue;
+                }
+
+                auto packed = _mm_packus_epi16(_mm_packs_epi32(vector0, vector1), _mm_packs_epi32(vector2, vector3));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(output + position), packed);
+            }
+        }
+    }
+
+#endif
+
+    for (; position < size; ++position) {
+        output[position] = StaticCast<ByteT>(EncodeLegacy(CodePointValue(codePoints[position]), encoding, substitute));
+    }
+
+    return size;
+}
+
+/**
+ * Detecting byte order mark
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param bomSize Byte order mark size (0 without byte order mark)
+ * @return Encoding of byte order mark or TextEncoding::Unknown
+ */
+template<typename ByteT>
+inline constexpr TextEncoding DetectBOM(ConstPtr<ByteT> bytes, ConstLRef<U64> size, LRef<U64> bomSize) {
+    auto byte = [bytes, size] (ConstLRef<U64> index) -> U32 {
+        return index < size ? StaticCast<U8>(bytes[index]) : 0x100;
+    };
+
+    bomSize = 0;
+
+    if (byte(0) == 0xEF && byte(1) == 0xBB && byte(2) == 0xBF) {
+        bomSize = 3;
+
+        return TextEncoding::UTF8;
+    }
+
+    // UTF-32LE before UTF-16LE, which has same first bytes
+    if (byte(0) == 0xFF && byte(1) == 0xFE && byte(2) == 0x00 && byte(3) == 0x00) {
+        bomSize = 4;
+
+        return TextEncoding::UTF32LE;
+    }
+
+    if (byte(0) == 0x00 && byte(1) == 0x00 && byte(2) == 0xFE && byte(3) == 0xFF) {
+        bomSize = 4;
+
+        return TextEncoding::UTF32BE;
+    }
+
+    if (byte(0) == 0xFF && byte(1) == 0xFE) {
+        bomSize = 2;
+
+        return TextEncoding::UTF16LE;
+    }
+
+    if (byte(0) == 0xFE && byte(1) == 0xFF) {
+        bomSize = 2;
+
+        return TextEncoding::UTF16BE;
+    }
+
+    return TextEncoding::Unknown;
+}
+
+/**
+ * Bytes count, which is used for encoding detection
+ */
+inline constexpr U64 TextEncodingDetectionSize = 64 * 1024;
+
+/**
+ * Scoring legacy Cyrillic encoding by histogram of bytes 0x80..0xFF, lowercase letters are most frequent in text
+ * @param histogram Histogram
+ * @param table Decode table
+ * @return Score
+ */
+inline constexpr I64 ScoreLegacyEncoding(ConstPtr<U64> histogram, ConstPtr<U16> table) {
+    I64 score = 0;
+
+    for (U64 index = 0; index < 128; ++index) {
+        U32 codePoint = table[0x80 + index];
+
+        I64 weight;
+
+        if (codePoint == 0x043E || codePoint == 0x0435 || codePoint == 0x0430 || codePoint == 0x0438 || codePoint == 0x043D
+            || codePoint == 0x0442 || codePoint == 0x0441 || codePoint == 0x0440 || codePoint == 0x0432 || codePoint == 0x043B) {
+            weight = 3;
+        } else if ((codePoint >= 0x0430 && codePoint <= 0x044F) || codePoint == 0x0451) {
+            weight = 2;
+        } else if ((codePoint >= 0x0410 && codePoint <= 0x042F) || codePoint == 0x0401) {
+            weight = 1;
+        } else {
+            weight = -2;
+        }
+
+        score += weight * StaticCast<I64>(histogram[index]);
+    }
+
+    return score;
+}
+
+/**
+ * Detecting text encoding by byte order mark, UTF-8 validity and byte statistics of first TextEncodingDetectionSize bytes
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @return Encoding (TextEncoding::UTF8 for ASCII text)
+ */
+template<typename ByteT>
+inline constexpr TextEncoding DetectTextEncoding(ConstPtr<ByteT> bytes, ConstLRef<U64> size) {
+    U64 bomSize;
+
+    auto bomEncoding = DetectBOM(bytes, size, bomSize);
+
+    if (bomEncoding != TextEncoding::Unknown) {
+        return bomEncoding;
+    }
+
+    auto sampleSize = size < TextEncodingDetectionSize ? size : TextEncodingDetectionSize;
+
+    U64 histogram[128] = {}, evenHistogram[256] = {}, oddHistogram[256] = {};
+
+    U64 controls = 0, highPairs = 0, highBytes = 0;
+
+    for (U64 index = 0; index < sampleSize; ++index) {
+        auto byte = StaticCast<U8>(bytes[index]);
+
+        ++(index % 2 == 0 ? evenHistogram : oddHistogram)[byte];
+
+        if (byte < 0x20) {
+            controls += byte < 0x09 || byte > 0x0D;
+        } else if (byte >= 0x80) {
+            ++histogram[byte - 0x80];
+
+            ++highBytes;
+
+            highPairs += index + 1 < sampleSize && StaticCast<U8>(bytes[index + 1]) >= 0x80;
+        }
+    }
+
+    // UTF-16 text has many control bytes, high bytes of code units have few values (zero or block of script)
+    if (controls * 16 > sampleSize) {
+        auto topTwo = [] (ConstPtr<U64> byteHistogram) {
+            U64 first = 0, second = 0;
+
+            for (U64 byte = 0; byte < 256; ++byte) {
+                if (byteHistogram[byte] > first) {
+                    second = first;
+
+                    first = byteHistogram[byte];
+                } else if (byteHistogram[byte] > second) {
+                    second = byteHistogram[byte];
+                }
+            }
+
+            return first + second;
+        };
+
+        auto unitsCount = sampleSize / 2;
+
+        if (topTwo(oddHistogram) * 4 > unitsCount * 3) {
+            return TextEncoding::UTF16LE;
+        }
+
+        if (topTwo(evenHistogram) * 4 > unitsCount * 3) {
+            return TextEncoding::UTF16BE;
+        }
+    }
+
+    // sample can end inside of sequence
+    auto errorPosition = FindUTF8Error(bytes, sampleSize);
+
+    if (errorPosition == sampleSize || (sampleSize < size && errorPosition + 3 >= sampleSize)) {
+        return TextEncoding::UTF8;
+    }
+
+    // letters of Cyrillic words are adjacent, accented Latin letters are mostly surrounded by ASCII
+    if (highPairs * 2 < highBytes) {
+        return TextEncoding::Latin1;
+    }
+
+    auto encoding = TextEncoding::Windows1251;
+
+    auto bestScore = ScoreLegacyEncoding(histogram, Windows1251DecodeTable.Data());
+
+    auto koi8rScore = ScoreLegacyEncoding(histogram, KOI8RDecodeTable.Data());
+
+    if (koi8rScore > bestScore) {
+        encoding = TextEncoding::KOI8R;
+
+        bestScore = koi8rScore;
+    }
+
+    auto cp866Score = ScoreLegacyEncoding(histogram, CP866DecodeTable.Data());
+
+    if (cp866Score > bestScore) {
+        encoding = TextEncoding::CP866;
+
+        bestScore = cp866Score;
+    }
+
+    return bestScore > 0 ? encoding : TextEncoding::Latin1;
+}
+
+inline constexpr Vector<U8> ToUTF32(ConstLRef<U32> codePoint) {
+    Vector<U8> bytes;
+
+    bytes.Append(codePoint >> 24);
+    bytes.Append((codePoint >> 16) & 0xFF);
+    bytes.Append((codePoint >> 8) & 0xFF);
+    bytes.Append(codePoint & 0xFF);
+
+    return bytes;
+}
+
+/**
+ * Encoding code point to UTF-32 big endian bytes without allocation
+ * @param codePoint Code point
+ * @param output Output bytes (at least 4 bytes)
+ * @return Bytes count
+ */
+template<typename ByteT>
+inline constexpr U8 EncodeUTF32(ConstLRef<U32> codePoint, Ptr<ByteT> output) noexcept {
+    output[0] = StaticCast<ByteT>(codePoint >> 24);
+    output[1] = StaticCast<ByteT>((codePoint >> 16) & 0xFF);
+    output[2] = StaticCast<ByteT>((codePoint >> 8) & 0xFF);
+    output[3] = StaticCast<ByteT>(codePoint & 0xFF);
+
+    return 4;
+}
+
+/**
+ * Decoding code point from UTF-32 big endian bytes without allocation
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param codePoint Code point or InvalidCodePoint for truncated input
+ * @return Count of decoded bytes
+ */
+template<typename ByteT>
+inline constexpr U8 FromUTF32(ConstPtr<ByteT> bytes, ConstLRef<U64> size, LRef<U32> codePoint) noexcept {
+    static_assert(sizeof(ByteT) == 1, "FromUTF32(ConstPtr<ByteT>, ConstLRef<U64>, LRef<U32>): Bytes must be one byte type!");
+
+    if (size < 4) {
+        codePoint = InvalidCodePoint;
+
+        return StaticCast<U8>(size);
+    }
+
+    codePoint = (StaticCast<U32>(StaticCast<U8>(bytes[0])) << 24)
+                + (StaticCast<U32>(StaticCast<U8>(bytes[1])) << 16)
+                + (StaticCast<U32>(StaticCast<U8>(bytes[2])) << 8)
+                + StaticCast<U32>(StaticCast<U8>(bytes[3]));
+
+    return 4;
+}
+
+inline constexpr U32 FromUTF32(ConstLRef<Vector<U8>> bytes) {
+    auto codePoint = InvalidCodePoint;
+
+    codePoint = (bytes[0] << 24)
+                + (bytes[1] << 16)
+                + (bytes[2] << 8)
+                + bytes[3];
+
+    return codePoint;
+}
+
+inline std::u16string UTF8ToUTF16(ConstLRef<std::string> string) {
+    std::u16string u16string;
+
+    u16string.resize(UTF8ToUTF16Length(string.data(), string.size()));
+
+    UTF8ToUTF16(string.data(), string.size(), u16string.data());
+
+    return u16string;
+}
+
+inline std::u32string UTF8ToUTF32(ConstLRef<std::string> string) {
+    std::u32string u32string;
+
+    u32string.resize(UTF8ToUTF32Length(string.data(), string.size()));
+
+    UTF8ToUTF32(string.data(), string.size(), u32string.data());
+
+    return u32string;
+}
+
+#if defined(__cpp_lib_char8_t)
+
+inline std::u16string UTF8ToUTF16(ConstLRef<std::u8string> string) {
+    std::u16string u16string;
+
+    u16string.resize(UTF8ToUTF16Length(string.data(), string.size()));
+
+    UTF8ToUTF16(string.data(), string.size(), u16string.data());
+
+    return u16string;
+}
+
+inline std::u32string UTF8ToUTF32(ConstLRef<std::u8string> string) {
+    std::u32string u32string;
+
+    u32string.resize(UTF8ToUTF32Length(string.data(), string.size()));
+
+    UTF8ToUTF32(string.data(), string.size(), u32string.data());
+
+    return u32string;
+}
+
+#endif
+
+inline std::string UTF16ToUTF8(ConstLRef<std::u16string> u16string) {
+    std::string string;
+
+    string.resize(UTF16ToUTF8Length(u16string.data(), u16string.size()));
+
+    UTF16ToUTF8(u16string.data(), u16string.size(), string.data());
+
+    return string;
+}
+
+inline std::u32string UTF16ToUTF32(ConstLRef<std::u16string> u16string) {
+    std::u32string u32string;
+
+    u32string.resize(UTF16ToUTF32Length(u16string.data(), u16string.size()));
+
+    UTF16ToUTF32(u16string.data(), u16string.size(), u32string.data());
+
+    return u32string;
+}
+
+inline std::string UTF32ToUTF8(ConstLRef<std::u32string> u32string) {
+    std::string string;
+
+    string.resize(UTF32ToUTF8Length(u32string.data(), u32string.size()));
+
+    UTF32ToUTF8(u32string.data(), u32string.size(), string.data());
+
+    return string;
+}
+
+inline std::u16string UTF32ToUTF16(ConstLRef<std::u32string> u32string) {
+    std::u16string u16string;
+
+    u16string.resize(UTF32ToUTF16Length(u32string.data(), u32string.size()));
+
+    UTF32ToUTF16(u32string.data(), u32string.size(), u16string.data());
 
     return u16string;
 }
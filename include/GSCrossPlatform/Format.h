@@ -0,0 +1,502 @@
+#ifndef GSCROSSPLATFORM_FORMAT_H
+#define GSCROSSPLATFORM_FORMAT_H
+
+#include <algorithm>
+#include <limits>
+
+#include <GSCrossPlatform/UString.h>
+
+enum class FormatArgumentKind : U8 {
+    Integer,
+    Floating,
+    Symbol,
+    String
+};
+
+template<typename T>
+inline constexpr Bool IsFormatArgument = std::is_arithmetic_v<T>
+                                         || std::is_same_v<T, USymbol>
+                                         || std::is_convertible_v<T, UStringView>
+                                         || std::is_convertible_v<T, ConstPtr<C>>
+                                         || std::is_same_v<T, std::string>;
+
+template<typename T>
+inline consteval FormatArgumentKind FormatArgumentKindOf() {
+    static_assert(IsFormatArgument<T>, "FormatArgumentKindOf<T>(): Unsupported type of Format argument!");
+
+    if constexpr (std::is_same_v<T, C> || std::is_same_v<T, C32> || std::is_same_v<T, USymbol>) {
+        return FormatArgumentKind::Symbol;
+    } else if constexpr (std::is_integral_v<T>) {
+        return FormatArgumentKind::Integer;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return FormatArgumentKind::Floating;
+    } else {
+        return FormatArgumentKind::String;
+    }
+}
+
+/**
+ * Parsed replacement field '{' [':' [[fill] align] [width] [type]] '}'
+ */
+class FormatSpec {
+public:
+
+    constexpr FormatSpec()
+            : _literalBegin(0),
+              _literalEnd(0),
+              _literalHasEscapes(false),
+              _fill(' '),
+              _hasAlignment(false),
+              _alignment(TextAlignment::Right),
+              _width(0),
+              _type(0) {}
+
+public:
+
+    /**
+     * Setting literal text before replacement field
+     * @param begin Begin of literal in format string
+     * @param end End of literal in format string
+     * @param hasEscapes Has literal escaped braces
+     * @return Spec
+     */
+    inline constexpr LRef<FormatSpec> SetLiteral(ConstLRef<U64> begin, ConstLRef<U64> end, ConstLRef<Bool> hasEscapes) {
+        _literalBegin = begin;
+
+        _literalEnd = end;
+
+        _literalHasEscapes = hasEscapes;
+
+        return *this;
+    }
+
+    inline constexpr LRef<FormatSpec> SetFill(ConstLRef<USymbol> fill) {
+        _fill = fill;
+
+        return *this;
+    }
+
+    inline constexpr LRef<FormatSpec> SetAlignment(TextAlignment alignment) {
+        _hasAlignment = true;
+
+        _alignment = alignment;
+
+        return *this;
+    }
+
+    inline constexpr LRef<FormatSpec> SetWidth(ConstLRef<U64> width) {
+        _width = width;
+
+        return *this;
+    }
+
+    inline constexpr LRef<FormatSpec> SetType(ConstLRef<C> type) {
+        _type = type;
+
+        return *this;
+    }
+
+public:
+
+    inline constexpr U64 LiteralBegin() const {
+        return _literalBegin;
+    }
+
+    inline constexpr U64 LiteralEnd() const {
+        return _literalEnd;
+    }
+
+    inline constexpr Bool LiteralHasEscapes() const {
+        return _literalHasEscapes;
+    }
+
+    inline constexpr USymbol Fill() const {
+        return _fill;
+    }
+
+    inline constexpr Bool HasAlignment() const {
+        return _hasAlignment;
+    }
+
+    inline constexpr TextAlignment Alignment() const {
+        return _alignment;
+    }
+
+    inline constexpr U64 Width() const {
+        return _width;
+    }
+
+    inline constexpr C Type() const {
+        return _type;
+    }
+
+private:
+
+    U64 _literalBegin;
+
+    U64 _literalEnd;
+
+    Bool _literalHasEscapes;
+
+    USymbol _fill;
+
+    Bool _hasAlignment;
+
+    TextAlignment _alignment;
+
+    U64 _width;
+
+    C _type;
+};
+
+/**
+ * Format string checked at compile time against argument types
+ *
+ * Supported replacement fields: {} and {:spec}, where spec is [[fill] align] [width] [type],
+ * align is one of '<', '>', '^' and type is one of 'd', 'x', 'X', 'b', 'o' for integers, 'c' for symbols and 's' for strings.
+ * Braces in text are escaped as {{ and }}
+ */
+template<typename... ArgsT>
+class UFormatString {
+public:
+
+    consteval UFormatString(UStringView format)
+            : _format(format), _tailBegin(0), _tailHasEscapes(false) {
+        Const<FormatArgumentKind> kinds[] = {FormatArgumentKindOf<ArgsT>()..., FormatArgumentKind::String};
+
+        U64 argumentIndex = 0;
+
+        U64 literalBegin = 0;
+
+        Bool literalHasEscapes = false;
+
+        auto size = format.Size();
+
+        for (U64 index = 0; index < size;) {
+            auto codePoint = format[index].CodePoint();
+
+            if (codePoint == '}') {
+                if (index + 1 < size && format[index + 1].CodePoint() == '}') {
+                    literalHasEscapes = true;
+
+                    index += 2;
+
+                    continue;
+                }
+
+                throw std::runtime_error("UFormatString::UFormatString(UStringView): Unmatched '}' in format string!");
+            }
+
+            if (codePoint != '{') {
+                ++index;
+
+                continue;
+            }
+
+            if (index + 1 < size && format[index + 1].CodePoint() == '{') {
+                literalHasEscapes = true;
+
+                index += 2;
+
+                continue;
+            }
+
+            if (argumentIndex >= sizeof...(ArgsT)) {
+                throw std::runtime_error("UFormatString::UFormatString(UStringView): More replacement fields than arguments!");
+            }
+
+            FormatSpec spec;
+
+            spec.SetLiteral(literalBegin, index, literalHasEscapes);
+
+            ++index;
+
+            if (index < size && format[index].CodePoint() == ':') {
+                ++index;
+
+                index = ParseSpec(format, index, spec);
+            }
+
+            if (index >= size || format[index].CodePoint() != '}') {
+                throw std::runtime_error("UFormatString::UFormatString(UStringView): Invalid replacement field in format string!");
+            }
+
+            ++index;
+
+            CheckType(spec, kinds[argumentIndex]);
+
+            _specs[argumentIndex] = spec;
+
+            ++argumentIndex;
+
+            literalBegin = index;
+
+            literalHasEscapes = false;
+        }
+
+        if (argumentIndex != sizeof...(ArgsT)) {
+            throw std::runtime_error("UFormatString::UFormatString(UStringView): Fewer replacement fields than arguments!");
+        }
+
+        _tailBegin = literalBegin;
+
+        _tailHasEscapes = literalHasEscapes;
+    }
+
+public:
+
+    inline constexpr UStringView Format() const {
+        return _format;
+    }
+
+    inline constexpr ConstLRef<FormatSpec> Spec(ConstLRef<U64> index) const {
+        return _specs.Data()[index];
+    }
+
+    inline constexpr U64 TailBegin() const {
+        return _tailBegin;
+    }
+
+    inline constexpr Bool TailHasEscapes() const {
+        return _tailHasEscapes;
+    }
+
+private:
+
+    static consteval U64 ParseSpec(UStringView format, U64 index, LRef<FormatSpec> spec) {
+        auto size = format.Size();
+
+        auto isAlignment = [] (ConstLRef<U32> codePoint) {
+            return codePoint == '<' || codePoint == '>' || codePoint == '^';
+        };
+
+        auto toAlignment = [] (ConstLRef<U32> codePoint) {
+            return codePoint == '<'
+                   ? TextAlignment::Left
+                   : codePoint == '>' ? TextAlignment::Right : TextAlignment::Center;
+        };
+
+        if (index + 1 < size && isAlignment(format[index + 1].CodePoint())) {
+            auto fill = format[index].CodePoint();
+
+            if (fill == '{' || fill == '}') {
+                throw std::runtime_error("UFormatString::ParseSpec(UStringView, U64, LRef<FormatSpec>): Invalid fill symbol!");
+            }
+
+            spec.SetFill(USymbol(fill))
+                .SetAlignment(toAlignment(format[index + 1].CodePoint()));
+
+            index += 2;
+        } else if (index < size && isAlignment(format[index].CodePoint())) {
+            spec.SetAlignment(toAlignment(format[index].CodePoint()));
+
+            ++index;
+        }
+
+        for (; index < size && format[index].IsDigit() && format[index].CodePoint() < 0x80; ++index) {
+            spec.SetWidth(spec.Width() * 10 + (format[index].CodePoint() - '0'));
+        }
+
+        if (index < size && format[index].CodePoint() != '}') {
+            spec.SetType(StaticCast<C>(format[index].CodePoint() < 0x80 ? format[index].CodePoint() : '?'));
+
+            ++index;
+        }
+
+        return index;
+    }
+
+    static consteval Void CheckType(ConstLRef<FormatSpec> spec, FormatArgumentKind kind) {
+        auto type = spec.Type();
+
+        if (type == 0) {
+            return;
+        }
+
+        Bool isValid = false;
+
+        switch (kind) {
+            case FormatArgumentKind::Integer:
+                isValid = type == 'd' || type == 'x' || type == 'X' || type == 'b' || type == 'o';
+
+                break;
+            case FormatArgumentKind::Symbol:
+                isValid = type == 'c';
+
+                break;
+            case FormatArgumentKind::String:
+                isValid = type == 's';
+
+                break;
+            default:
+                break;
+        }
+
+        if (!isValid) {
+            throw std::runtime_error("UFormatString::CheckType(ConstLRef<FormatSpec>, FormatArgumentKind): Format type does not match argument type!");
+        }
+    }
+
+private:
+
+    UStringView _format;
+
+    Array<FormatSpec, (sizeof...(ArgsT) > 0 ? sizeof...(ArgsT) : 1)> _specs;
+
+    U64 _tailBegin;
+
+    Bool _tailHasEscapes;
+};
+
+/**
+ * Format string type for arguments (literal arrays are checked as pointers)
+ */
+template<typename... ArgsT>
+using UFormatStringFor = UFormatString<std::decay_t<Const<ArgsT>>...>;
+
+/**
+ * Appending literal text of format string, collapsing escaped braces
+ * @param stream Stream
+ * @param text Text
+ * @param hasEscapes Is text contains escaped braces
+ */
+inline constexpr Void AppendFormatLiteral(LRef<UStringStream> stream, UStringView text, Bool hasEscapes) {
+    if (!hasEscapes) {
+        stream << text;
+
+        return;
+    }
+
+    U64 begin = 0;
+
+    for (U64 index = 0; index < text.Size(); ++index) {
+        auto codePoint = text[index].CodePoint();
+
+        if (codePoint == '{' || codePoint == '}') {
+            stream << text.Substring(begin, index + 1 - begin);
+
+            ++index;
+
+            begin = index + 1;
+        }
+    }
+
+    stream << text.Substring(begin);
+}
+
+template<typename T>
+inline constexpr U64 FormatSizeEstimate(ConstLRef<T> value) {
+    if constexpr (std::is_same_v<T, UString> || std::is_same_v<T, UStringView>) {
+        return value.Size();
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return value.size();
+    } else if constexpr (std::is_integral_v<T>) {
+        return std::numeric_limits<T>::digits10 + 2;
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return 24;
+    } else {
+        return 16;
+    }
+}
+
+template<typename T>
+inline Void FormatArgument(LRef<UStringStream> stream, ConstLRef<FormatSpec> spec, ConstLRef<T> value) {
+    constexpr auto kind = FormatArgumentKindOf<T>();
+
+    auto alignment = kind == FormatArgumentKind::String || kind == FormatArgumentKind::Symbol
+                     ? TextAlignment::Left
+                     : TextAlignment::Right;
+
+    stream.SetWidth(spec.Width())
+          .SetFill(spec.Fill())
+          .SetAlignment(spec.HasAlignment() ? spec.Alignment() : alignment);
+
+    if constexpr (kind == FormatArgumentKind::Integer) {
+        switch (spec.Type()) {
+            case 'x':
+            case 'X':
+                stream.SetBase(16);
+
+                break;
+            case 'b':
+                stream.SetBase(2);
+
+                break;
+            case 'o':
+                stream.SetBase(8);
+
+                break;
+            default:
+                stream.SetBase(10);
+
+                break;
+        }
+
+        stream.SetUppercase(spec.Type() == 'X');
+    }
+
+    stream << value;
+}
+
+/**
+ * Formatting arguments into stream
+ * @tparam ArgsT Argument types
+ * @param stream Stream
+ * @param format Format string
+ * @param args Arguments
+ */
+template<typename... ArgsT>
+inline Void FormatTo(LRef<UStringStream> stream, UFormatStringFor<ArgsT...> format, ConstLRef<ArgsT>... args) {
+    auto fill = stream.Fill();
+
+    auto alignment = stream.Alignment();
+
+    auto base = stream.Base();
+
+    auto uppercase = stream.Uppercase();
+
+    auto formatString = format.Format();
+
+    U64 sizeEstimate = formatString.Size();
+
+    U64 index = 0;
+
+    ((sizeEstimate += std::max(format.Spec(index).Width(), FormatSizeEstimate<std::decay_t<Const<ArgsT>>>(args)), ++index), ...);
+
+    stream.Reserve(stream.Size() + sizeEstimate);
+
+    stream.SetWidth(0);
+
+    index = 0;
+
+    ((AppendFormatLiteral(stream,
+                          formatString.Substring(format.Spec(index).LiteralBegin(), format.Spec(index).LiteralEnd() - format.Spec(index).LiteralBegin()),
+                          format.Spec(index).LiteralHasEscapes()),
+      FormatArgument<std::decay_t<Const<ArgsT>>>(stream, format.Spec(index), args),
+      ++index), ...);
+
+    AppendFormatLiteral(stream, formatString.Substring(format.TailBegin()), format.TailHasEscapes());
+
+    stream.SetFill(fill)
+          .SetAlignment(alignment)
+          .SetBase(base)
+          .SetUppercase(uppercase);
+}
+
+/**
+ * Formatting arguments into string
+ * @tparam ArgsT Argument types
+ * @param format Format string
+ * @param args Arguments
+ * @return Formatted string
+ */
+template<typename... ArgsT>
+inline UString Format(UFormatStringFor<ArgsT...> format, ConstLRef<ArgsT>... args) {
+    UStringStream stream;
+
+    FormatTo<ArgsT...>(stream, format, args...);
+
+    return stream.Take();
+}
+
+#endif //GSCROSSPLATFORM_FORMAT_H
@@ -1,9 +1,12 @@
 #ifndef GSCROSSPLATFORM_IO_H
 #define GSCROSSPLATFORM_IO_H
 
+#include <cstdio>
 #include <iostream>
+#include <string>
 
 #include <GSCrossPlatform/UString.h>
+#include <GSCrossPlatform/UTF8Codec.h>
 
 inline LRef<std::istream> operator>>(LRef<std::istream> stream, LRef<USymbol> symbol) {
     auto byte = StaticCast<U8>(stream.get());
@@ -14,17 +17,15 @@ inline LRef<std::istream> operator>>(LRef<std::istream> stream, LRef<USymbol> sy
 
     auto symbolSize = UTF8Size(byte);
 
-    Vector<U8> bytes;
-
-    bytes.Append(byte);
+    U8 bytes[4] = {byte};
 
     for (U64 i = 1; i < symbolSize; ++i) {
-        byte = StaticCast<U8>(stream.get());
-
-        bytes.Append(byte);
+        bytes[i] = StaticCast<U8>(stream.get());
     }
 
-    auto codePoint = FromUTF8(bytes);
+    U32 codePoint;
+
+    FromUTF8(StaticCast<ConstPtr<U8>>(bytes), symbolSize > 0 ? symbolSize : 1, codePoint);
 
     symbol = USymbol(codePoint);
 
@@ -32,39 +33,254 @@ inline LRef<std::istream> operator>>(LRef<std::istream> stream, LRef<USymbol> sy
 }
 
 inline LRef<std::ostream> operator<<(LRef<std::ostream> stream, ConstLRef<USymbol> symbol) {
-    auto bytes = ToUTF8(symbol.CodePoint());
+    Array<U8, 4> bytes;
 
-    for (auto &byte : bytes) {
-        stream.put(StaticCast<C>(byte));
-    }
+    auto bytesCount = symbol.AsUTF8(bytes);
+
+    stream.write(ReinterpretCast<ConstPtr<C>>(bytes.Data()), StaticCast<std::streamsize>(bytesCount));
 
     return stream;
 }
 
 inline LRef<std::istream> operator>>(LRef<std::istream> stream, LRef<UString> string) {
-    while (true) {
-        USymbol symbol;
+    std::string line;
 
-        stream >> symbol;
+    std::getline(stream, line);
 
-        if (symbol == '\n' || stream.eof()) {
-            break;
-        }
-
-        string.Append(symbol);
-    }
+    string += UString(line);
 
     return stream;
 }
 
 inline LRef<std::ostream> operator<<(LRef<std::ostream> stream, ConstLRef<UString> string) {
-    for (auto &symbol : string) {
-        stream << symbol;
+    constexpr U64 blockSize = 256;
+
+    C bytes[blockSize * 4];
+
+    for (U64 position = 0; position < string.Size(); position += blockSize) {
+        auto size = string.Size() - position < blockSize ? string.Size() - position : blockSize;
+
+        auto bytesCount = UTF32ToUTF8(string.Data() + position, size, bytes);
+
+        stream.write(bytes, StaticCast<std::streamsize>(bytesCount));
     }
 
     return stream;
 }
 
+/**
+ * Buffered UTF-8 reader from file descriptor, FILE or stream buffer
+ *
+ * Input is read in blocks of BufferSize bytes and decoded in bulk, malformed sequences are replaced with U+FFFD.
+ * CRLF is normalized to LF during decoding (can be disabled). Reader doesn't own source
+ */
+class UTF8Reader {
+public:
+
+    inline static constexpr U64 BufferSize = 64 * 1024;
+
+public:
+
+    explicit UTF8Reader(I32 fileDescriptor, Bool normalizeNewLines = true);
+
+    explicit UTF8Reader(Ptr<std::FILE> file, Bool normalizeNewLines = true);
+
+    explicit UTF8Reader(Ptr<std::streambuf> streamBuffer, Bool normalizeNewLines = true);
+
+    explicit UTF8Reader(LRef<std::istream> stream, Bool normalizeNewLines = true);
+
+public:
+
+    /**
+     * Reading next symbol
+     * @param symbol Symbol
+     * @return Is symbol read (false at end of input)
+     */
+    Bool ReadSymbol(LRef<USymbol> symbol);
+
+    /**
+     * Reading next symbol without consuming it
+     * @param symbol Symbol
+     * @return Is symbol read (false at end of input)
+     */
+    Bool Peek(LRef<USymbol> symbol);
+
+    /**
+     * Reading line without line feed
+     * @param line Line
+     * @return Is line read (false at end of input)
+     */
+    Bool ReadLine(LRef<UString> line);
+
+    /**
+     * Reading all remaining input
+     * @return String
+     */
+    UString ReadAll();
+
+    Bool IsEnd();
+
+private:
+
+    Bool Fill();
+
+    U64 ReadBytes(Ptr<U8> bytes, ConstLRef<U64> size);
+
+    U64 NormalizeNewLines(Ptr<USymbol> symbols, U64 size);
+
+private:
+
+    enum class SourceType : U8 {
+        FileDescriptor,
+        File,
+        StreamBuffer
+    };
+
+private:
+
+    SourceType _sourceType;
+
+    I32 _fileDescriptor;
+
+    Ptr<std::FILE> _file;
+
+    Ptr<std::streambuf> _streamBuffer;
+
+    Bool _normalizeNewLines;
+
+    Bool _pendingCarriageReturn;
+
+    Bool _isEndOfInput;
+
+    UTF8Decoder _decoder;
+
+    Vector<U8> _bytes;
+
+    Vector<USymbol> _symbols;
+
+    U64 _symbolsCount;
+
+    U64 _position;
+};
+
+/**
+ * Buffering mode of UTF8Writer
+ */
+enum class UTF8WriterBuffering : U8 {
+    Full,
+    Line,
+    None
+};
+
+/**
+ * Buffered UTF-8 writer into file descriptor, FILE or stream buffer
+ *
+ * Strings are encoded in bulk into buffer of BufferSize bytes. Buffer is flushed when full (Full),
+ * after writing line feed (Line) or after every write (None). Writer doesn't own destination, buffer is flushed on destruction
+ */
+class UTF8Writer {
+public:
+
+    inline static constexpr U64 BufferSize = 64 * 1024;
+
+public:
+
+    explicit UTF8Writer(I32 fileDescriptor, UTF8WriterBuffering buffering = UTF8WriterBuffering::Full);
+
+    explicit UTF8Writer(Ptr<std::FILE> file, UTF8WriterBuffering buffering = UTF8WriterBuffering::Full);
+
+    explicit UTF8Writer(Ptr<std::streambuf> streamBuffer, UTF8WriterBuffering buffering = UTF8WriterBuffering::Full);
+
+    explicit UTF8Writer(LRef<std::ostream> stream, UTF8WriterBuffering buffering = UTF8WriterBuffering::Full);
+
+    UTF8Writer(ConstLRef<UTF8Writer> writer) = delete;
+
+public:
+
+    ~UTF8Writer();
+
+public:
+
+    Void Write(ConstLRef<USymbol> symbol);
+
+    Void Write(ConstLRef<UStringView> view);
+
+    Void Write(ConstLRef<UString> string);
+
+    /**
+     * Writing UTF-8 bytes without encoding
+     * @param bytes Bytes
+     * @param size Bytes count
+     */
+    Void WriteUTF8(ConstPtr<C> bytes, ConstLRef<U64> size);
+
+    /**
+     * Writing string and line feed
+     * @param view String
+     */
+    Void WriteLine(ConstLRef<UStringView> view);
+
+    /**
+     * Writing buffered bytes into destination
+     */
+    Void Flush();
+
+public:
+
+    LRef<UTF8Writer> operator=(ConstLRef<UTF8Writer> writer) = delete;
+
+    inline LRef<UTF8Writer> operator<<(ConstLRef<USymbol> symbol) {
+        Write(symbol);
+
+        return *this;
+    }
+
+    inline LRef<UTF8Writer> operator<<(ConstLRef<UStringView> view) {
+        Write(view);
+
+        return *this;
+    }
+
+    inline LRef<UTF8Writer> operator<<(ConstLRef<UString> string) {
+        Write(string);
+
+        return *this;
+    }
+
+private:
+
+    Void FlushIfNeeded(Bool hasLineFeed);
+
+    /**
+     * Writing bytes into destination directly (two parts are written with one writev for file descriptor)
+     */
+    Void WriteBytes(ConstPtr<U8> first, U64 firstSize, ConstPtr<U8> second, U64 secondSize);
+
+private:
+
+    enum class DestinationType : U8 {
+        FileDescriptor,
+        File,
+        StreamBuffer
+    };
+
+private:
+
+    DestinationType _destinationType;
+
+    I32 _fileDescriptor;
+
+    Ptr<std::FILE> _file;
+
+    Ptr<std::streambuf> _streamBuffer;
+
+    UTF8WriterBuffering _buffering;
+
+    Vector<U8> _buffer;
+
+    U64 _size;
+};
+
 Bool EnableUnicodeConsole();
 
 static Bool IsEnabledUnicodeConsole = EnableUnicodeConsole();
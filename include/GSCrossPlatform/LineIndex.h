@@ -0,0 +1,323 @@
+#ifndef GSCROSSPLATFORM_LINEINDEX_H
+#define GSCROSSPLATFORM_LINEINDEX_H
+
+#include <bit>
+
+#include <GSCrossPlatform/Map.h>
+#include <GSCrossPlatform/UString.h>
+
+#if defined(GS_SIMD_VECTOR)
+
+/**
+ * Line feed in every 4-byte lane (little endian code points)
+ */
+inline constexpr U8 LineFeedSymbolPattern[32] = {
+        '\n', 0, 0, 0, '\n', 0, 0, 0, '\n', 0, 0, 0, '\n', 0, 0, 0,
+        '\n', 0, 0, 0, '\n', 0, 0, 0, '\n', 0, 0, 0, '\n', 0, 0, 0
+};
+
+#endif
+
+/**
+ * Finding next line feed in bytes or code points (integer or USymbol like type)
+ * @param values Bytes or code points
+ * @param size Values count
+ * @param position Start position
+ * @return Position of line feed or values count
+ */
+template<typename ValueT>
+inline constexpr U64 FindLineFeed(ConstPtr<ValueT> values, ConstLRef<U64> size, U64 position) {
+#if defined(GS_SIMD_VECTOR)
+
+    if (!std::is_constant_evaluated()) {
+        if constexpr (sizeof(ValueT) == 1) {
+            auto bytes = ReinterpretCast<ConstPtr<U8>>(values);
+
+            auto lineFeeds = SIMDSplat('\n');
+
+            for (; position + SIMDVectorSize <= size; position += SIMDVectorSize) {
+                auto mask = SIMDMoveMask(SIMDEqual(SIMDLoad(bytes + position), lineFeeds));
+
+                if (mask != 0) {
+                    return position + std::countr_zero(mask);
+                }
+            }
+        } else if constexpr (sizeof(ValueT) == 4 && std::is_trivially_copyable_v<ValueT> && std::endian::native == std::endian::little) {
+            auto bytes = ReinterpretCast<ConstPtr<U8>>(values);
+
+            auto lineFeeds = SIMDLoad(LineFeedSymbolPattern);
+
+            constexpr U64 symbolsCount = SIMDVectorSize / 4;
+
+            for (; position + symbolsCount <= size; position += symbolsCount) {
+                auto mask = SIMDMoveMask(SIMDEqual(SIMDLoad(bytes + position * 4), lineFeeds));
+
+                // symbol is line feed if all 4 bytes are equal
+                mask &= mask >> 1;
+
+                mask &= mask >> 2;
+
+                mask &= 0x1111111111111111ULL;
+
+                if (mask != 0) {
+                    return position + std::countr_zero(mask) / 4;
+                }
+            }
+        }
+    }
+
+#endif
+
+    while (position < size && CodePointValue(values[position]) != '\n') {
+        ++position;
+    }
+
+    return position;
+}
+
+/**
+ * Lazy range of lines in string without line feeds
+ *
+ * Lines are separated by line feeds, so string with N line feeds has N + 1 lines
+ */
+class LineRange {
+public:
+
+    class Iterator {
+    public:
+
+        constexpr Iterator()
+                : _data(nullptr), _size(0), _begin(1), _end(0) {}
+
+        constexpr Iterator(ConstPtr<USymbol> data, ConstLRef<U64> size)
+                : _data(data), _size(size), _begin(0), _end(FindLineFeed(data, size, 0)) {}
+
+    public:
+
+        inline constexpr UStringView operator*() const {
+            return UStringView(_data + _begin, _end - _begin);
+        }
+
+        inline constexpr LRef<Iterator> operator++() {
+            if (_end == _size) {
+                *this = Iterator();
+
+                return *this;
+            }
+
+            _begin = _end + 1;
+
+            _end = FindLineFeed(_data, _size, _begin);
+
+            return *this;
+        }
+
+        inline constexpr Iterator operator++(I32) {
+            auto iterator = *this;
+
+            ++*this;
+
+            return iterator;
+        }
+
+        inline constexpr Bool operator==(ConstLRef<Iterator> iterator) const {
+            return _data == iterator._data && _begin == iterator._begin;
+        }
+
+        inline constexpr Bool operator!=(ConstLRef<Iterator> iterator) const {
+            return !operator==(iterator);
+        }
+
+    private:
+
+        ConstPtr<USymbol> _data;
+
+        U64 _size;
+
+        U64 _begin;
+
+        U64 _end;
+    };
+
+public:
+
+    constexpr LineRange(ConstLRef<UStringView> view)
+            : _view(view) {}
+
+public:
+
+    inline constexpr Iterator begin() const {
+        return Iterator(_view.Data(), _view.Size());
+    }
+
+    inline constexpr Iterator end() const {
+        return Iterator();
+    }
+
+private:
+
+    UStringView _view;
+};
+
+/**
+ * Getting lazy range of lines in string
+ * @param view String
+ * @return Lines
+ */
+inline constexpr LineRange Lines(ConstLRef<UStringView> view) {
+    return LineRange(view);
+}
+
+/**
+ * Index of line start offsets for line and column lookup
+ *
+ * Offsets are code point offsets for UString and byte offsets for UTF-8.
+ * Offsets are stored as 32-bit values for texts smaller than 4 GiB
+ */
+class LineIndex {
+public:
+
+    constexpr LineIndex()
+            : _size(0), _isWide(false) {
+        _lineStarts.Append(0);
+    }
+
+    explicit constexpr LineIndex(ConstLRef<UStringView> view)
+            : LineIndex(view.Data(), view.Size()) {}
+
+    explicit constexpr LineIndex(ConstLRef<UString> string)
+            : LineIndex(string.Data(), string.Size()) {}
+
+    /**
+     * Constructor for index of bytes or code points
+     * @param values UTF-8 bytes or code points
+     * @param size Values count
+     */
+    template<typename ValueT>
+    constexpr LineIndex(ConstPtr<ValueT> values, ConstLRef<U64> size)
+            : _size(size), _isWide(size > 0xFFFFFFFFULL) {
+        for (U64 position = 0;; ++position) {
+            if (_isWide) {
+                _wideLineStarts.Append(position);
+            } else {
+                _lineStarts.Append(StaticCast<U32>(position));
+            }
+
+            position = FindLineFeed(values, size, position);
+
+            if (position == size) {
+                break;
+            }
+        }
+    }
+
+public:
+
+    inline constexpr U64 LinesCount() const {
+        return _isWide ? _wideLineStarts.Size() : _lineStarts.Size();
+    }
+
+    /**
+     * Getting offset of line start
+     * @param line Line (from 0)
+     * @return Offset
+     */
+    inline constexpr U64 LineStart(ConstLRef<U64> line) const {
+        return _isWide ? _wideLineStarts[line] : _lineStarts[line];
+    }
+
+    /**
+     * Getting offset of line end (offset of line feed or text size)
+     * @param line Line (from 0)
+     * @return Offset
+     */
+    inline constexpr U64 LineEnd(ConstLRef<U64> line) const {
+        return line + 1 < LinesCount() ? LineStart(line + 1) - 1 : _size;
+    }
+
+    /**
+     * Finding line of offset with binary search
+     * @param offset Offset
+     * @return Line (from 0)
+     */
+    inline constexpr U64 LineOf(ConstLRef<U64> offset) const {
+        return _isWide ? FindLine(_wideLineStarts, offset) : FindLine(_lineStarts, offset);
+    }
+
+    /**
+     * Finding column of offset
+     * @param offset Offset
+     * @return Column (from 0) in offset units
+     */
+    inline constexpr U64 ColumnOf(ConstLRef<U64> offset) const {
+        return offset - LineStart(LineOf(offset));
+    }
+
+    /**
+     * Finding column of byte offset in symbols for index of UTF-8 bytes
+     * @param bytes UTF-8 bytes of index
+     * @param offset Byte offset
+     * @return Column (from 0) in symbols
+     */
+    template<typename ByteT>
+    inline constexpr U64 SymbolColumnOf(ConstPtr<ByteT> bytes, ConstLRef<U64> offset) const {
+        auto lineStart = LineStart(LineOf(offset));
+
+        return CountUTF8Symbols(bytes + lineStart, offset - lineStart);
+    }
+
+    /**
+     * Finding line and column of offset
+     * @param offset Offset
+     * @return Line and column (from 0)
+     */
+    inline constexpr Pair<U64, U64> Position(ConstLRef<U64> offset) const {
+        auto line = LineOf(offset);
+
+        return Pair<U64, U64>(line, offset - LineStart(line));
+    }
+
+    /**
+     * Getting line of indexed string without line feed
+     * @param view Indexed string
+     * @param line Line (from 0)
+     * @return Line
+     */
+    inline constexpr UStringView Line(ConstLRef<UStringView> view, ConstLRef<U64> line) const {
+        auto lineStart = LineStart(line);
+
+        return UStringView(view.Data() + lineStart, LineEnd(line) - lineStart);
+    }
+
+private:
+
+    template<typename OffsetT>
+    static inline constexpr U64 FindLine(ConstLRef<Vector<OffsetT>> lineStarts, ConstLRef<U64> offset) {
+        // first line start greater than offset
+        U64 lower = 0, upper = lineStarts.Size();
+
+        while (lower < upper) {
+            auto middle = lower + (upper - lower) / 2;
+
+            if (lineStarts.Data()[middle] <= offset) {
+                lower = middle + 1;
+            } else {
+                upper = middle;
+            }
+        }
+
+        return lower - 1;
+    }
+
+private:
+
+    Vector<U32> _lineStarts;
+
+    Vector<U64> _wideLineStarts;
+
+    U64 _size;
+
+    Bool _isWide;
+};
+
+#endif //GSCROSSPLATFORM_LINEINDEX_H
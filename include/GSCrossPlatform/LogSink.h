@@ -0,0 +1,164 @@
+#ifndef GSCROSSPLATFORM_LOGSINK_H
+#define GSCROSSPLATFORM_LOGSINK_H
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include <GSCrossPlatform/IO.h>
+
+/**
+ * Severity of log message
+ */
+enum class LogLevel : U8 {
+    Trace,
+    Debug,
+    Info,
+    Warning,
+    Error,
+    Fatal,
+    Off
+};
+
+/**
+ * Behaviour of LogSink when message queue is full
+ */
+enum class LogDropPolicy : U8 {
+    DropNewest,
+    Block
+};
+
+/**
+ * Asynchronous logging sink with lock-free multi-producer queue
+ *
+ * Messages are copied into bounded ring of reusable cells, background thread encodes them to UTF-8 in batches
+ * and writes them with UTF8Writer. Messages below severity level are filtered before formatting
+ */
+class LogSink {
+public:
+
+    /**
+     * Constructor for sink
+     * @param fileDescriptor Output file descriptor
+     * @param level Minimum severity level
+     * @param capacity Queue capacity in messages (rounded up to power of two)
+     * @param dropPolicy Behaviour when queue is full
+     */
+    explicit LogSink(I32 fileDescriptor = 1,
+                     LogLevel level = LogLevel::Info,
+                     U64 capacity = 4096,
+                     LogDropPolicy dropPolicy = LogDropPolicy::DropNewest);
+
+    LogSink(ConstLRef<LogSink> sink) = delete;
+
+public:
+
+    /**
+     * Destructor, queued messages are written before stopping background thread
+     */
+    ~LogSink();
+
+public:
+
+    /**
+     * Queueing message
+     * @param level Severity level
+     * @param message Message
+     * @return Is message queued (false for filtered or dropped message)
+     */
+    Bool Log(LogLevel level, ConstLRef<UStringView> message);
+
+    inline Bool Log(LogLevel level, ConstLRef<UString> message) {
+        return Log(level, UStringView(message));
+    }
+
+    /**
+     * Queueing lazily formatted message, function is called only for enabled level
+     * @param level Severity level
+     * @param function Function returning message
+     * @return Is message queued
+     */
+    template<typename FunctionT>
+    inline Bool LogLazy(LogLevel level, FunctionT function) {
+        if (!IsEnabled(level)) {
+            return false;
+        }
+
+        return Log(level, function());
+    }
+
+    /**
+     * Waiting until all messages queued before call are written
+     */
+    Void Flush();
+
+public:
+
+    inline Bool IsEnabled(LogLevel level) const {
+        return level != LogLevel::Off && level >= _level.load(std::memory_order_relaxed);
+    }
+
+    inline Void SetLevel(LogLevel level) {
+        _level.store(level, std::memory_order_relaxed);
+    }
+
+    inline LogLevel Level() const {
+        return _level.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Getting count of messages dropped because of full queue
+     * @return Count of messages
+     */
+    inline U64 DroppedCount() const {
+        return _droppedCount.load(std::memory_order_relaxed);
+    }
+
+public:
+
+    LRef<LogSink> operator=(ConstLRef<LogSink> sink) = delete;
+
+private:
+
+    Void Run();
+
+    /**
+     * Writing all published messages
+     * @return Count of written messages
+     */
+    U64 Drain();
+
+    Void WakeUp();
+
+private:
+
+    class Cell;
+
+    std::unique_ptr<Cell[]> _cells;
+
+    U64 _mask;
+
+    LogDropPolicy _dropPolicy;
+
+    std::atomic<LogLevel> _level;
+
+    alignas(64) std::atomic<U64> _enqueuePosition;
+
+    alignas(64) U64 _dequeuePosition;
+
+    std::atomic<U64> _writtenPosition;
+
+    std::atomic<U64> _droppedCount;
+
+    std::atomic<Bool> _isWaiting;
+
+    std::atomic<U32> _signal;
+
+    std::atomic<Bool> _isStopping;
+
+    UTF8Writer _writer;
+
+    std::thread _thread;
+};
+
+#endif //GSCROSSPLATFORM_LOGSINK_H
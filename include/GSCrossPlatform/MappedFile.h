@@ -0,0 +1,115 @@
+#ifndef GSCROSSPLATFORM_MAPPEDFILE_H
+#define GSCROSSPLATFORM_MAPPEDFILE_H
+
+#include <span>
+#include <string>
+
+#include <GSCrossPlatform/UTF8View.h>
+
+/**
+ * Access pattern hint for mapped file pages
+ */
+enum class MappedFileAccess : U8 {
+    Normal,
+    Sequential,
+    Random
+};
+
+/**
+ * Read-only memory mapped file
+ *
+ * Bytes are accessed without copying, UTF-8 views are validated on demand and decoding into UString is lazy
+ */
+class MappedFile {
+public:
+
+    MappedFile();
+
+    /**
+     * Mapping file
+     * @param path Path to file
+     * @param access Access pattern hint
+     * @param useHugePages Requesting huge pages for mapping, if supported by OS
+     */
+    explicit MappedFile(ConstLRef<std::string> path, MappedFileAccess access = MappedFileAccess::Sequential, Bool useHugePages = false);
+
+    MappedFile(ConstLRef<MappedFile> file) = delete;
+
+    MappedFile(RRef<MappedFile> file) noexcept;
+
+public:
+
+    ~MappedFile();
+
+public:
+
+    Void Close();
+
+public:
+
+    inline std::span<Const<U8>> Bytes() const {
+        return std::span<Const<U8>>(_data, _size);
+    }
+
+    inline ConstPtr<U8> Data() const {
+        return _data;
+    }
+
+    inline U64 Size() const {
+        return _size;
+    }
+
+    inline Bool IsOpen() const {
+        return _isOpen;
+    }
+
+public:
+
+    /**
+     * Getting validated UTF-8 view of file
+     * @return View
+     */
+    inline UTF8View View() const {
+        return UTF8View(_data, _size);
+    }
+
+    /**
+     * Getting validated UTF-8 view of part of file (only this part is validated)
+     * @param offset Byte offset (must be on symbol boundary)
+     * @param size Bytes count
+     * @return View
+     */
+    UTF8View View(ConstLRef<U64> offset, ConstLRef<U64> size) const;
+
+    /**
+     * Decoding file into string (malformed sequences are replaced with U+FFFD)
+     * @return String
+     */
+    inline UString Decode() const {
+        return UString(ReinterpretCast<ConstPtr<C>>(_data), _size);
+    }
+
+public:
+
+    LRef<MappedFile> operator=(ConstLRef<MappedFile> file) = delete;
+
+    LRef<MappedFile> operator=(RRef<MappedFile> file) noexcept;
+
+private:
+
+    ConstPtr<U8> _data;
+
+    U64 _size;
+
+    Bool _isOpen;
+
+#if defined(GS_OS_WINDOWS)
+
+    Ptr<Void> _fileHandle;
+
+    Ptr<Void> _mappingHandle;
+
+#endif
+};
+
+#endif //GSCROSSPLATFORM_MAPPEDFILE_H
@@ -0,0 +1,47 @@
+#ifndef GSCROSSPLATFORM_PARALLELTRANSCODING_H
+#define GSCROSSPLATFORM_PARALLELTRANSCODING_H
+
+#include <string>
+
+#include <GSCrossPlatform/Encoding.h>
+
+/**
+ * Multi-threaded transcoding of large buffers
+ *
+ * Input is split at code point boundaries into chunks of at least ParallelTranscodingChunkSize elements,
+ * output lengths of chunks are counted on worker threads and combined with prefix sum,
+ * then each worker transcodes its chunk directly into preallocated output.
+ * Inputs smaller than two chunks are transcoded on calling thread. Output is the same as of single-threaded transcoding
+ */
+
+/**
+ * Minimum input elements count for one worker thread
+ */
+inline constexpr U64 ParallelTranscodingChunkSize = 4 * 1024 * 1024;
+
+/**
+ * Threads count for parallel transcoding by default (hardware concurrency)
+ * @return Threads count
+ */
+U32 ParallelTranscodingThreadsCount();
+
+/**
+ * Transcoding UTF-8 to UTF-32 on multiple threads (malformed sequences are replaced with U+FFFD)
+ * @param bytes Bytes
+ * @param size Bytes count
+ * @param threadsCount Threads count (0 for ParallelTranscodingThreadsCount())
+ * @return UTF-32 string
+ */
+std::u32string ParallelUTF8ToUTF32(ConstPtr<C> bytes, ConstLRef<U64> size, U32 threadsCount = 0);
+
+std::u16string ParallelUTF8ToUTF16(ConstPtr<C> bytes, ConstLRef<U64> size, U32 threadsCount = 0);
+
+std::string ParallelUTF16ToUTF8(ConstPtr<C16> units, ConstLRef<U64> size, U32 threadsCount = 0);
+
+std::u32string ParallelUTF16ToUTF32(ConstPtr<C16> units, ConstLRef<U64> size, U32 threadsCount = 0);
+
+std::string ParallelUTF32ToUTF8(ConstPtr<C32> codePoints, ConstLRef<U64> size, U32 threadsCount = 0);
+
+std::u16string ParallelUTF32ToUTF16(ConstPtr<C32> codePoints, ConstLRef<U64> size, U32 threadsCount = 0);
+
+#endif //GSCROSSPLATFORM_PARALLELTRANSCODING_H
@@ -0,0 +1,416 @@
+#ifndef GSCROSSPLATFORM_PARSE_H
+#define GSCROSSPLATFORM_PARSE_H
+
+#include <limits>
+
+#include <GSCrossPlatform/Format.h>
+#include <GSCrossPlatform/UException.h>
+
+enum class ParseError : U8 {
+    None,
+    Empty,
+    InvalidSymbol,
+    InvalidBase,
+    Overflow
+};
+
+template<typename ValueT>
+class ParseResult {
+public:
+
+    using ValueType = ValueT;
+
+public:
+
+    constexpr ParseResult(ValueType value, ConstLRef<U64> position, ParseError error)
+            : _value(value), _position(position), _error(error) {}
+
+public:
+
+    inline constexpr ValueType Value() const {
+        return _value;
+    }
+
+    /**
+     * Position of the first symbol that was not consumed by parsing
+     * @return Position
+     */
+    inline constexpr U64 Position() const {
+        return _position;
+    }
+
+    inline constexpr ParseError Error() const {
+        return _error;
+    }
+
+    inline constexpr Bool IsOk() const {
+        return _error == ParseError::None;
+    }
+
+private:
+
+    ValueType _value;
+
+    U64 _position;
+
+    ParseError _error;
+};
+
+inline constexpr U32 DigitValue(ConstLRef<U32> codePoint) {
+    if (codePoint - '0' < 10) {
+        return codePoint - '0';
+    }
+
+    auto lowerCodePoint = codePoint | 0x20;
+
+    if (lowerCodePoint - 'a' < 26) {
+        return lowerCodePoint - 'a' + 10;
+    }
+
+    return 36;
+}
+
+/**
+ * Parsing eight decimal digits at once (SWAR)
+ * @param symbols Symbols (at least eight)
+ * @param value Parsed value
+ * @return Is all eight symbols decimal digits
+ */
+inline constexpr Bool ParseEightDigits(ConstPtr<USymbol> symbols, LRef<U32> value) {
+    U32 codePointsMask = 0;
+
+    U64 bytes = 0;
+
+    for (U64 index = 0; index < 8; ++index) {
+        auto codePoint = symbols[index].CodePoint();
+
+        codePointsMask |= codePoint;
+
+        bytes |= StaticCast<U64>(codePoint & 0xFF) << (index * 8);
+    }
+
+    if (codePointsMask > 0x7F
+     || (((bytes + 0x4646464646464646) | (bytes - 0x3030303030303030)) & 0x8080808080808080) != 0) {
+        return false;
+    }
+
+    bytes -= 0x3030303030303030;
+
+    bytes = (bytes * 10) + (bytes >> 8);
+
+    bytes = (((bytes & 0x000000FF000000FF) * 0x000F424000000064)
+           + (((bytes >> 16) & 0x000000FF000000FF) * 0x0000271000000001)) >> 32;
+
+    value = StaticCast<U32>(bytes);
+
+    return true;
+}
+
+template<typename ValueT>
+inline constexpr ParseResult<ValueT> TryParseInt(UStringView string, I32 base = 10) {
+    static_assert(std::is_integral_v<ValueT> && !std::is_same_v<ValueT, Bool>, "TryParseInt: ValueT must be integer type!");
+
+    if (base < 2 || base > 36) {
+        return ParseResult<ValueT>(ValueT(), 0, ParseError::InvalidBase);
+    }
+
+    if (string.Empty()) {
+        return ParseResult<ValueT>(ValueT(), 0, ParseError::Empty);
+    }
+
+    auto symbols = string.Data();
+
+    auto size = string.Size();
+
+    U64 position = 0;
+
+    auto isNegative = false;
+
+    if (symbols[0] == '+' || (std::is_signed_v<ValueT> && symbols[0] == '-')) {
+        isNegative = symbols[0] == '-';
+
+        ++position;
+    }
+
+    auto limit = StaticCast<U64>(std::numeric_limits<ValueT>::max()) + (isNegative ? 1 : 0);
+
+    auto digitsPosition = position;
+
+    U64 magnitude = 0;
+
+    if (base == 10) {
+        for (U32 chunk = 0; position + 8 <= size && ParseEightDigits(symbols + position, chunk); position += 8) {
+            if (chunk > limit || magnitude > (limit - chunk) / 100000000) {
+                break;
+            }
+
+            magnitude = magnitude * 100000000 + chunk;
+        }
+    }
+
+    for (; position < size; ++position) {
+        auto digit = DigitValue(symbols[position].CodePoint());
+
+        if (digit >= StaticCast<U32>(base)) {
+            break;
+        }
+
+        if (magnitude > (limit - digit) / base) {
+            return ParseResult<ValueT>(ValueT(), position, ParseError::Overflow);
+        }
+
+        magnitude = magnitude * base + digit;
+    }
+
+    if (position == digitsPosition) {
+        return ParseResult<ValueT>(ValueT(), position, ParseError::InvalidSymbol);
+    }
+
+    auto value = StaticCast<ValueT>(isNegative ? 0 - magnitude : magnitude);
+
+    return ParseResult<ValueT>(value, position, position == size ? ParseError::None : ParseError::InvalidSymbol);
+}
+
+template<typename ValueT>
+inline ParseResult<ValueT> TryParseFloat(UStringView string) {
+    static_assert(std::is_floating_point_v<ValueT>, "TryParseFloat: ValueT must be floating point type!");
+
+    if (string.Empty()) {
+        return ParseResult<ValueT>(ValueT(), 0, ParseError::Empty);
+    }
+
+    auto symbols = string.Data();
+
+    auto size = string.Size();
+
+    U64 position = 0;
+
+    auto isNegative = false;
+
+    if (symbols[0] == '+' || symbols[0] == '-') {
+        isNegative = symbols[0] == '-';
+
+        ++position;
+    }
+
+    auto numberPosition = position;
+
+    U64 mantissa = 0;
+
+    I64 exponent = 0;
+
+    U64 significantDigits = 0;
+
+    U64 digitsCount = 0;
+
+    auto isTruncated = false;
+
+    auto parseDigits = [&](ConstLRef<Bool> isFraction) {
+        while (position < size) {
+            U32 chunk = 0;
+
+            if (mantissa != 0
+             && significantDigits + 8 <= 19
+             && position + 8 <= size
+             && ParseEightDigits(symbols + position, chunk)) {
+                mantissa = mantissa * 100000000 + chunk;
+
+                significantDigits += 8;
+
+                exponent -= isFraction ? 8 : 0;
+
+                position += 8;
+
+                digitsCount += 8;
+
+                continue;
+            }
+
+            auto digit = symbols[position].CodePoint() - '0';
+
+            if (digit >= 10) {
+                break;
+            }
+
+            if (significantDigits < 19) {
+                if (mantissa != 0 || digit != 0) {
+                    mantissa = mantissa * 10 + digit;
+
+                    ++significantDigits;
+                }
+
+                exponent -= isFraction ? 1 : 0;
+            } else {
+                isTruncated = isTruncated || digit != 0;
+
+                exponent += isFraction ? 0 : 1;
+            }
+
+            ++position;
+
+            ++digitsCount;
+        }
+    };
+
+    parseDigits(false);
+
+    if (position < size && symbols[position] == '.') {
+        ++position;
+
+        parseDigits(true);
+    }
+
+    auto isSpecial = digitsCount == 0
+                  && position == numberPosition
+                  && position < size
+                  && ((symbols[position].CodePoint() | 0x20) == 'i' || (symbols[position].CodePoint() | 0x20) == 'n');
+
+    if (digitsCount == 0 && !isSpecial) {
+        return ParseResult<ValueT>(ValueT(), numberPosition, ParseError::InvalidSymbol);
+    }
+
+    if (position < size && (symbols[position].CodePoint() | 0x20) == 'e' && !isSpecial) {
+        auto exponentPosition = position + 1;
+
+        auto isExponentNegative = false;
+
+        if (exponentPosition < size && (symbols[exponentPosition] == '+' || symbols[exponentPosition] == '-')) {
+            isExponentNegative = symbols[exponentPosition] == '-';
+
+            ++exponentPosition;
+        }
+
+        if (exponentPosition < size && symbols[exponentPosition].CodePoint() - '0' < 10) {
+            I64 explicitExponent = 0;
+
+            for (; exponentPosition < size && symbols[exponentPosition].CodePoint() - '0' < 10; ++exponentPosition) {
+                if (explicitExponent < 100000) {
+                    explicitExponent = explicitExponent * 10 + (symbols[exponentPosition].CodePoint() - '0');
+                }
+            }
+
+            exponent += isExponentNegative ? -explicitExponent : explicitExponent;
+
+            position = exponentPosition;
+        }
+    }
+
+    auto error = position == size ? ParseError::None : ParseError::InvalidSymbol;
+
+    // Clinger's fast path: mantissa and power of ten are both exactly representable
+    if constexpr (std::is_same_v<ValueT, double> || std::is_same_v<ValueT, float>) {
+        constexpr I64 maxExponent = std::is_same_v<ValueT, double> ? 22 : 10;
+
+        constexpr U64 maxMantissa = std::is_same_v<ValueT, double> ? (1ULL << 53) : (1ULL << 24);
+
+        constexpr ValueT powersOfTen[] = {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+        };
+
+        if (!isSpecial && !isTruncated && mantissa <= maxMantissa && exponent >= -maxExponent && exponent <= maxExponent) {
+            auto value = StaticCast<ValueT>(mantissa);
+
+            value = exponent < 0 ? value / powersOfTen[-exponent] : value * powersOfTen[exponent];
+
+            return ParseResult<ValueT>(isNegative ? -value : value, position, error);
+        }
+    }
+
+    // Slow path: std::from_chars is locale-independent and correctly rounded
+    auto length = isSpecial ? 0 : position - numberPosition;
+
+    if (isSpecial) {
+        for (; numberPosition + length < size && length < 8 && symbols[numberPosition + length].CodePoint() < 0x80; ++length);
+    }
+
+    C stackBuffer[64];
+
+    std::string heapBuffer;
+
+    auto buffer = stackBuffer;
+
+    if (length > sizeof(stackBuffer)) {
+        heapBuffer.resize(length);
+
+        buffer = heapBuffer.data();
+    }
+
+    for (U64 index = 0; index < length; ++index) {
+        buffer[index] = StaticCast<C>(symbols[numberPosition + index].CodePoint());
+    }
+
+    auto value = ValueT();
+
+    auto [pointer, errorCode] = std::from_chars(buffer, buffer + length, value);
+
+    if (errorCode == std::errc::invalid_argument) {
+        return ParseResult<ValueT>(ValueT(), numberPosition, ParseError::InvalidSymbol);
+    }
+
+    position = numberPosition + (pointer - buffer);
+
+    if (errorCode == std::errc::result_out_of_range) {
+        return ParseResult<ValueT>(ValueT(), position, ParseError::Overflow);
+    }
+
+    error = position == size ? ParseError::None : ParseError::InvalidSymbol;
+
+    return ParseResult<ValueT>(isNegative ? -value : value, position, error);
+}
+
+template<typename ValueT>
+inline constexpr ParseResult<ValueT> TryParse(UStringView string, I32 base = 10) {
+    if constexpr (std::is_floating_point_v<ValueT>) {
+        if (base != 10) {
+            return ParseResult<ValueT>(ValueT(), 0, ParseError::InvalidBase);
+        }
+
+        return TryParseFloat<ValueT>(string);
+    } else {
+        return TryParseInt<ValueT>(string, base);
+    }
+}
+
+inline constexpr UStringView ParseErrorDescription(ParseError error) {
+    switch (error) {
+        case ParseError::Empty:
+            return "Empty string"_us;
+        case ParseError::InvalidSymbol:
+            return "Invalid symbol"_us;
+        case ParseError::InvalidBase:
+            return "Invalid base"_us;
+        case ParseError::Overflow:
+            return "Value out of range"_us;
+        default:
+            return "No error"_us;
+    }
+}
+
+inline UString ParseErrorMessage(UStringView function, ParseError error, ConstLRef<U64> position) {
+    return Format("{}: {} at position {}!"_us, function, ParseErrorDescription(error), position);
+}
+
+template<typename ValueT>
+inline ValueT ParseInt(UStringView string, I32 base = 10) {
+    auto result = TryParseInt<ValueT>(string, base);
+
+    if (!result.IsOk()) {
+        throw UException(ParseErrorMessage("ParseInt(UStringView, I32)"_us, result.Error(), result.Position()));
+    }
+
+    return result.Value();
+}
+
+template<typename ValueT>
+inline ValueT ParseFloat(UStringView string) {
+    auto result = TryParseFloat<ValueT>(string);
+
+    if (!result.IsOk()) {
+        throw UException(ParseErrorMessage("ParseFloat(UStringView)"_us, result.Error(), result.Position()));
+    }
+
+    return result.Value();
+}
+
+#endif //GSCROSSPLATFORM_PARSE_H
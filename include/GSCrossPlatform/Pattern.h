@@ -0,0 +1,1543 @@
+#ifndef GSCROSSPLATFORM_PATTERN_H
+#define GSCROSSPLATFORM_PATTERN_H
+
+#include <GSCrossPlatform/UString.h>
+
+/**
+ * Compile-time patterns
+ *
+ * Pattern<R"([a-z_]\w*)"> is compiled at compile time into DFA over classes of code points and matched without allocations.
+ *
+ * Syntax:
+ *  - literal symbols, '.' (any symbol except '\n')
+ *  - [abc], [a-z], [^...] (sets, escapes allowed inside)
+ *  - \d, \s, \w (Unicode digit, whitespace and ID continue symbols), \D, \S, \W (negations),
+ *    \p{Alpha}, \p{Digit}, \p{Whitespace}, \p{IDStart}, \p{IDContinue} and \P{...} (negations)
+ *  - \n, \r, \t, \x{HEX} and escaped metasymbols
+ *  - (...), (?:...) (groups without captures), | (alternation)
+ *  - *, +, ?, {m}, {m,}, {m,n} (quantifiers)
+ *
+ * Matches are leftmost-longest. Search runs DFA from all start positions at once and takes linear time in scanned symbols
+ */
+
+inline constexpr U64 PatternMaxNFAStates = 256;
+
+inline constexpr U64 PatternMaxSymbolSets = 64;
+
+inline constexpr U64 PatternMaxRanges = 16;
+
+inline constexpr U64 PatternMaxBoundaries = 256;
+
+inline constexpr U64 PatternMaxRawClasses = 2048;
+
+inline constexpr U64 PatternMaxClasses = 64;
+
+inline constexpr U64 PatternMaxDFAStates = 128;
+
+inline constexpr U32 PatternNone = ~0U;
+
+inline constexpr U32 PatternProperties[] = {
+        UnicodeAlphaFlag,
+        UnicodeDigitFlag,
+        UnicodeWhitespaceFlag,
+        UnicodeIDStartFlag,
+        UnicodeIDContinueFlag
+};
+
+/**
+ * Set of symbols in pattern, union of code point ranges and symbols with any of properties
+ */
+class PatternSymbolSet {
+public:
+
+    constexpr PatternSymbolSet()
+            : _ranges{}, _rangesCount(0), _properties(0), _negated(false) {}
+
+public:
+
+    consteval Void AddRange(ConstLRef<U32> first, ConstLRef<U32> last) {
+        if (first > last || last > 0x10FFFF) {
+            throw std::runtime_error("PatternSymbolSet::AddRange(ConstLRef<U32>, ConstLRef<U32>): Invalid range in pattern!");
+        }
+
+        if (_rangesCount == PatternMaxRanges) {
+            throw std::runtime_error("PatternSymbolSet::AddRange(ConstLRef<U32>, ConstLRef<U32>): Too many ranges in symbol set!");
+        }
+
+        _ranges[_rangesCount][0] = first;
+
+        _ranges[_rangesCount][1] = last;
+
+        ++_rangesCount;
+    }
+
+    /**
+     * Checking membership of all code points of interval starting at code point with properties
+     * @param codePoint First code point of interval (ranges never split intervals)
+     * @param properties Properties
+     * @return Is member
+     */
+    inline constexpr Bool Contains(ConstLRef<U32> codePoint, ConstLRef<U32> properties) const {
+        auto isMember = (_properties & properties) != 0;
+
+        for (U64 index = 0; index < _rangesCount; ++index) {
+            isMember = isMember || (codePoint >= _ranges[index][0] && codePoint <= _ranges[index][1]);
+        }
+
+        return isMember != _negated;
+    }
+
+    inline constexpr Bool operator==(ConstLRef<PatternSymbolSet> symbolSet) const {
+        if (_rangesCount != symbolSet._rangesCount
+         || _properties != symbolSet._properties
+         || _negated != symbolSet._negated) {
+            return false;
+        }
+
+        for (U64 index = 0; index < _rangesCount; ++index) {
+            if (_ranges[index][0] != symbolSet._ranges[index][0] || _ranges[index][1] != symbolSet._ranges[index][1]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+public:
+
+    inline constexpr Void AddProperties(ConstLRef<U32> properties) {
+        _properties |= properties;
+    }
+
+    inline constexpr Void SetNegated(ConstLRef<Bool> negated) {
+        _negated = negated;
+    }
+
+public:
+
+    inline constexpr U64 RangesCount() const {
+        return _rangesCount;
+    }
+
+    inline constexpr U32 RangeFirst(ConstLRef<U64> index) const {
+        return _ranges[index][0];
+    }
+
+    inline constexpr U32 RangeLast(ConstLRef<U64> index) const {
+        return _ranges[index][1];
+    }
+
+    inline constexpr U32 Properties() const {
+        return _properties;
+    }
+
+    inline constexpr Bool IsNegated() const {
+        return _negated;
+    }
+
+private:
+
+    U32 _ranges[PatternMaxRanges][2];
+
+    U64 _rangesCount;
+
+    U32 _properties;
+
+    Bool _negated;
+};
+
+/**
+ * Set of NFA states
+ */
+class PatternStateSet {
+public:
+
+    constexpr PatternStateSet()
+            : _words{} {}
+
+public:
+
+    inline constexpr Void Add(ConstLRef<U32> state) {
+        _words[state / 64] |= 1ULL << (state % 64);
+    }
+
+    inline constexpr Bool Contains(ConstLRef<U32> state) const {
+        return (_words[state / 64] >> (state % 64)) & 1;
+    }
+
+    inline constexpr Bool Empty() const {
+        for (auto &word : _words) {
+            if (word != 0) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    inline constexpr Bool operator==(ConstLRef<PatternStateSet> stateSet) const {
+        for (U64 index = 0; index < PatternMaxNFAStates / 64; ++index) {
+            if (_words[index] != stateSet._words[index]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+private:
+
+    U64 _words[PatternMaxNFAStates / 64];
+};
+
+/**
+ * NFA state with up to two epsilon transitions and one transition by symbol set
+ */
+class PatternNFAState {
+public:
+
+    constexpr PatternNFAState()
+            : _epsilon{PatternNone, PatternNone}, _symbolSet(PatternNone), _next(PatternNone) {}
+
+public:
+
+    inline constexpr Void SetEpsilon(ConstLRef<U64> index, ConstLRef<U32> next) {
+        _epsilon[index] = next;
+    }
+
+    inline constexpr Void SetTransition(ConstLRef<U32> symbolSet, ConstLRef<U32> next) {
+        _symbolSet = symbolSet;
+
+        _next = next;
+    }
+
+public:
+
+    inline constexpr U32 Epsilon(ConstLRef<U64> index) const {
+        return _epsilon[index];
+    }
+
+    inline constexpr U32 SymbolSet() const {
+        return _symbolSet;
+    }
+
+    inline constexpr U32 Next() const {
+        return _next;
+    }
+
+private:
+
+    U32 _epsilon[2];
+
+    U32 _symbolSet;
+
+    U32 _next;
+};
+
+class PatternFragment {
+public:
+
+    constexpr PatternFragment(ConstLRef<U32> start, ConstLRef<U32> end)
+            : _start(start), _end(end) {}
+
+public:
+
+    inline constexpr U32 Start() const {
+        return _start;
+    }
+
+    inline constexpr U32 End() const {
+        return _end;
+    }
+
+private:
+
+    U32 _start;
+
+    U32 _end;
+};
+
+/**
+ * Compiler of pattern into NFA (Thompson construction) and DFA (subset construction) over classes of code points
+ *
+ * Code points are split into intervals by bounds of all ranges in pattern and combinations of used properties,
+ * intervals with equal membership in all symbol sets form one class
+ */
+class PatternCompiler {
+public:
+
+    consteval PatternCompiler(UStringView pattern)
+            : _pattern(pattern),
+              _nfaStatesCount(0),
+              _nfaStart(0),
+              _nfaAccept(0),
+              _symbolSetsCount(0),
+              _boundaries{},
+              _boundariesCount(0),
+              _properties{},
+              _propertiesCount(0),
+              _rawClasses{},
+              _classSignatures{},
+              _classesCount(0),
+              _asciiClasses{},
+              _dfaStatesCount(0),
+              _transitions{},
+              _accepting{} {
+        U64 position = 0;
+
+        auto fragment = ParseAlternation(position);
+
+        if (position != _pattern.Size()) {
+            throw std::runtime_error("PatternCompiler::PatternCompiler(UStringView): Unmatched ')' in pattern!");
+        }
+
+        _nfaStart = fragment.Start();
+
+        _nfaAccept = fragment.End();
+
+        BuildClasses();
+
+        BuildDFA();
+    }
+
+private:
+
+    consteval U32 Peek(ConstLRef<U64> position) const {
+        return position < _pattern.Size() ? _pattern[position].CodePoint() : PatternNone;
+    }
+
+    consteval U32 AddState() {
+        if (_nfaStatesCount == PatternMaxNFAStates) {
+            throw std::runtime_error("PatternCompiler::AddState(): Pattern is too big!");
+        }
+
+        return StaticCast<U32>(_nfaStatesCount++);
+    }
+
+    consteval Void AddEpsilon(ConstLRef<U32> from, ConstLRef<U32> to) {
+        auto &state = _nfaStates[from];
+
+        if (state.Epsilon(0) == PatternNone) {
+            state.SetEpsilon(0, to);
+        } else if (state.Epsilon(1) == PatternNone) {
+            state.SetEpsilon(1, to);
+        } else {
+            throw std::runtime_error("PatternCompiler::AddEpsilon(ConstLRef<U32>, ConstLRef<U32>): Invalid NFA construction!");
+        }
+    }
+
+    consteval U32 AddSymbolSet(ConstLRef<PatternSymbolSet> symbolSet) {
+        for (U64 index = 0; index < _symbolSetsCount; ++index) {
+            if (_symbolSets[index] == symbolSet) {
+                return StaticCast<U32>(index);
+            }
+        }
+
+        if (_symbolSetsCount == PatternMaxSymbolSets) {
+            throw std::runtime_error("PatternCompiler::AddSymbolSet(ConstLRef<PatternSymbolSet>): Too many symbol sets in pattern!");
+        }
+
+        _symbolSets[_symbolSetsCount] = symbolSet;
+
+        return StaticCast<U32>(_symbolSetsCount++);
+    }
+
+    consteval PatternFragment EmptyFragment() {
+        auto state = AddState();
+
+        return PatternFragment(state, state);
+    }
+
+    consteval PatternFragment SymbolSetFragment(ConstLRef<PatternSymbolSet> symbolSet) {
+        auto start = AddState();
+
+        auto end = AddState();
+
+        _nfaStates[start].SetTransition(AddSymbolSet(symbolSet), end);
+
+        return PatternFragment(start, end);
+    }
+
+    consteval PatternFragment Concatenate(ConstLRef<PatternFragment> first, ConstLRef<PatternFragment> second) {
+        AddEpsilon(first.End(), second.Start());
+
+        return PatternFragment(first.Start(), second.End());
+    }
+
+    consteval PatternFragment Star(ConstLRef<PatternFragment> fragment) {
+        auto start = AddState();
+
+        auto end = AddState();
+
+        AddEpsilon(start, fragment.Start());
+
+        AddEpsilon(start, end);
+
+        AddEpsilon(fragment.End(), fragment.Start());
+
+        AddEpsilon(fragment.End(), end);
+
+        return PatternFragment(start, end);
+    }
+
+    consteval PatternFragment Plus(ConstLRef<PatternFragment> fragment) {
+        auto end = AddState();
+
+        AddEpsilon(fragment.End(), fragment.Start());
+
+        AddEpsilon(fragment.End(), end);
+
+        return PatternFragment(fragment.Start(), end);
+    }
+
+    consteval PatternFragment Optional(ConstLRef<PatternFragment> fragment) {
+        auto start = AddState();
+
+        auto end = AddState();
+
+        AddEpsilon(start, fragment.Start());
+
+        AddEpsilon(start, end);
+
+        AddEpsilon(fragment.End(), end);
+
+        return PatternFragment(start, end);
+    }
+
+    consteval PatternFragment ParseAlternation(LRef<U64> position) {
+        auto fragment = ParseConcatenation(position);
+
+        while (Peek(position) == '|') {
+            ++position;
+
+            auto alternative = ParseConcatenation(position);
+
+            auto start = AddState();
+
+            auto end = AddState();
+
+            AddEpsilon(start, fragment.Start());
+
+            AddEpsilon(start, alternative.Start());
+
+            AddEpsilon(fragment.End(), end);
+
+            AddEpsilon(alternative.End(), end);
+
+            fragment = PatternFragment(start, end);
+        }
+
+        return fragment;
+    }
+
+    consteval PatternFragment ParseConcatenation(LRef<U64> position) {
+        auto fragment = EmptyFragment();
+
+        while (position < _pattern.Size() && Peek(position) != '|' && Peek(position) != ')') {
+            fragment = Concatenate(fragment, ParseRepetition(position));
+        }
+
+        return fragment;
+    }
+
+    consteval U64 ParseNumber(LRef<U64> position) const {
+        if (Peek(position) < '0' || Peek(position) > '9') {
+            throw std::runtime_error("PatternCompiler::ParseNumber(LRef<U64>): Expected number in quantifier!");
+        }
+
+        U64 number = 0;
+
+        while (Peek(position) >= '0' && Peek(position) <= '9') {
+            number = number * 10 + (Peek(position) - '0');
+
+            ++position;
+        }
+
+        return number;
+    }
+
+    /**
+     * Making copy of atom for bounded repetition by parsing atom again
+     * @param atomPosition Position of atom
+     * @param isFirstCopy Is already parsed fragment not used yet
+     * @param fragment Already parsed fragment
+     * @return Copy of atom
+     */
+    consteval PatternFragment CopyAtom(ConstLRef<U64> atomPosition, LRef<Bool> isFirstCopy, ConstLRef<PatternFragment> fragment) {
+        if (isFirstCopy) {
+            isFirstCopy = false;
+
+            return fragment;
+        }
+
+        auto copyPosition = atomPosition;
+
+        return ParseAtom(copyPosition);
+    }
+
+    consteval PatternFragment ParseRepetition(LRef<U64> position) {
+        auto atomPosition = position;
+
+        auto fragment = ParseAtom(position);
+
+        auto quantifier = Peek(position);
+
+        if (quantifier == '*') {
+            fragment = Star(fragment);
+
+            ++position;
+        } else if (quantifier == '+') {
+            fragment = Plus(fragment);
+
+            ++position;
+        } else if (quantifier == '?') {
+            fragment = Optional(fragment);
+
+            ++position;
+        } else if (quantifier == '{') {
+            ++position;
+
+            auto minimum = ParseNumber(position);
+
+            auto maximum = minimum;
+
+            auto isUnbounded = false;
+
+            if (Peek(position) == ',') {
+                ++position;
+
+                if (Peek(position) == '}') {
+                    isUnbounded = true;
+                } else {
+                    maximum = ParseNumber(position);
+                }
+            }
+
+            if (Peek(position) != '}' || minimum > maximum) {
+                throw std::runtime_error("PatternCompiler::ParseRepetition(LRef<U64>): Invalid quantifier in pattern!");
+            }
+
+            ++position;
+
+            auto isFirstCopy = true;
+
+            auto repetition = EmptyFragment();
+
+            for (U64 index = 0; index < minimum; ++index) {
+                repetition = Concatenate(repetition, CopyAtom(atomPosition, isFirstCopy, fragment));
+            }
+
+            if (isUnbounded) {
+                repetition = Concatenate(repetition, Star(CopyAtom(atomPosition, isFirstCopy, fragment)));
+            } else {
+                for (U64 index = minimum; index < maximum; ++index) {
+                    repetition = Concatenate(repetition, Optional(CopyAtom(atomPosition, isFirstCopy, fragment)));
+                }
+            }
+
+            fragment = repetition;
+        } else {
+            return fragment;
+        }
+
+        auto nextSymbol = Peek(position);
+
+        if (nextSymbol == '*' || nextSymbol == '+' || nextSymbol == '?' || nextSymbol == '{') {
+            throw std::runtime_error("PatternCompiler::ParseRepetition(LRef<U64>): Nested quantifier in pattern!");
+        }
+
+        return fragment;
+    }
+
+    consteval PatternFragment ParseAtom(LRef<U64> position) {
+        auto codePoint = Peek(position);
+
+        if (codePoint == '(') {
+            ++position;
+
+            if (Peek(position) == '?') {
+                if (Peek(position + 1) != ':') {
+                    throw std::runtime_error("PatternCompiler::ParseAtom(LRef<U64>): Unsupported group in pattern!");
+                }
+
+                position += 2;
+            }
+
+            auto fragment = ParseAlternation(position);
+
+            if (Peek(position) != ')') {
+                throw std::runtime_error("PatternCompiler::ParseAtom(LRef<U64>): Unmatched '(' in pattern!");
+            }
+
+            ++position;
+
+            return fragment;
+        }
+
+        if (codePoint == '*' || codePoint == '+' || codePoint == '?' || codePoint == '{') {
+            throw std::runtime_error("PatternCompiler::ParseAtom(LRef<U64>): Quantifier without operand in pattern!");
+        }
+
+        PatternSymbolSet symbolSet;
+
+        if (codePoint == '[') {
+            ++position;
+
+            ParseSet(position, symbolSet);
+        } else if (codePoint == '.') {
+            ++position;
+
+            symbolSet.AddRange('\n', '\n');
+
+            symbolSet.SetNegated(true);
+        } else if (codePoint == '\\') {
+            ++position;
+
+            ParseEscape(position, symbolSet);
+        } else {
+            ++position;
+
+            symbolSet.AddRange(codePoint, codePoint);
+        }
+
+        return SymbolSetFragment(symbolSet);
+    }
+
+    consteval Void ParseSet(LRef<U64> position, LRef<PatternSymbolSet> symbolSet) {
+        if (Peek(position) == '^') {
+            symbolSet.SetNegated(true);
+
+            ++position;
+        }
+
+        for (auto isFirst = true; Peek(position) != ']'; isFirst = false) {
+            auto first = Peek(position);
+
+            if (first == PatternNone) {
+                throw std::runtime_error("PatternCompiler::ParseSet(LRef<U64>, LRef<PatternSymbolSet>): Unmatched '[' in pattern!");
+            }
+
+            ++position;
+
+            if (first == '\\') {
+                PatternSymbolSet escapeSet;
+
+                ParseEscape(position, escapeSet);
+
+                if (escapeSet.IsNegated()) {
+                    throw std::runtime_error("PatternCompiler::ParseSet(LRef<U64>, LRef<PatternSymbolSet>): Negated escape in symbol set is not supported!");
+                }
+
+                symbolSet.AddProperties(escapeSet.Properties());
+
+                if (escapeSet.RangesCount() != 1 || escapeSet.RangeFirst(0) != escapeSet.RangeLast(0)) {
+                    for (U64 index = 0; index < escapeSet.RangesCount(); ++index) {
+                        symbolSet.AddRange(escapeSet.RangeFirst(index), escapeSet.RangeLast(index));
+                    }
+
+                    continue;
+                }
+
+                first = escapeSet.RangeFirst(0);
+            }
+
+            auto last = first;
+
+            if (Peek(position) == '-' && Peek(position + 1) != ']' && Peek(position + 1) != PatternNone && !(isFirst && first == '-')) {
+                ++position;
+
+                last = Peek(position);
+
+                ++position;
+
+                if (last == '\\') {
+                    PatternSymbolSet escapeSet;
+
+                    ParseEscape(position, escapeSet);
+
+                    if (escapeSet.IsNegated() || escapeSet.RangesCount() != 1 || escapeSet.RangeFirst(0) != escapeSet.RangeLast(0)) {
+                        throw std::runtime_error("PatternCompiler::ParseSet(LRef<U64>, LRef<PatternSymbolSet>): Invalid range in pattern!");
+                    }
+
+                    last = escapeSet.RangeFirst(0);
+                }
+            }
+
+            symbolSet.AddRange(first, last);
+        }
+
+        ++position;
+    }
+
+    consteval Void ParseEscape(LRef<U64> position, LRef<PatternSymbolSet> symbolSet) {
+        auto codePoint = Peek(position);
+
+        if (codePoint == PatternNone) {
+            throw std::runtime_error("PatternCompiler::ParseEscape(LRef<U64>, LRef<PatternSymbolSet>): Unterminated escape in pattern!");
+        }
+
+        ++position;
+
+        switch (codePoint) {
+            case 'd':
+            case 'D':
+                symbolSet.AddProperties(UnicodeDigitFlag);
+
+                break;
+            case 's':
+            case 'S':
+                symbolSet.AddProperties(UnicodeWhitespaceFlag);
+
+                break;
+            case 'w':
+            case 'W':
+                symbolSet.AddProperties(UnicodeIDContinueFlag);
+
+                break;
+            case 'p':
+            case 'P':
+                symbolSet.AddProperties(ParseProperty(position));
+
+                break;
+            case 'n':
+                symbolSet.AddRange('\n', '\n');
+
+                break;
+            case 'r':
+                symbolSet.AddRange('\r', '\r');
+
+                break;
+            case 't':
+                symbolSet.AddRange('\t', '\t');
+
+                break;
+            case 'x': {
+                auto value = ParseHex(position);
+
+                symbolSet.AddRange(value, value);
+
+                break;
+            }
+            default:
+                if ((codePoint >= 'a' && codePoint <= 'z') || (codePoint >= 'A' && codePoint <= 'Z') || (codePoint >= '0' && codePoint <= '9')) {
+                    throw std::runtime_error("PatternCompiler::ParseEscape(LRef<U64>, LRef<PatternSymbolSet>): Unknown escape in pattern!");
+                }
+
+                symbolSet.AddRange(codePoint, codePoint);
+
+                break;
+        }
+
+        symbolSet.SetNegated(codePoint == 'D' || codePoint == 'S' || codePoint == 'W' || codePoint == 'P');
+    }
+
+    consteval U32 ParseProperty(LRef<U64> position) const {
+        Const<ConstPtr<C>> names[] = {"Alpha", "Digit", "Whitespace", "IDStart", "IDContinue"};
+
+        if (Peek(position) != '{') {
+            throw std::runtime_error("PatternCompiler::ParseProperty(LRef<U64>): Expected '{' after property escape in pattern!");
+        }
+
+        ++position;
+
+        for (U64 index = 0; index < std::size(names); ++index) {
+            U64 size = 0;
+
+            while (names[index][size] != 0 && Peek(position + size) == StaticCast<U32>(names[index][size])) {
+                ++size;
+            }
+
+            if (names[index][size] == 0 && Peek(position + size) == '}') {
+                position += size + 1;
+
+                return PatternProperties[index];
+            }
+        }
+
+        throw std::runtime_error("PatternCompiler::ParseProperty(LRef<U64>): Unknown property in pattern!");
+    }
+
+    consteval U32 ParseHex(LRef<U64> position) const {
+        if (Peek(position) != '{') {
+            throw std::runtime_error("PatternCompiler::ParseHex(LRef<U64>): Expected '{' after \\x in pattern!");
+        }
+
+        ++position;
+
+        U32 value = 0;
+
+        for (; Peek(position) != '}'; ++position) {
+            auto digit = Peek(position);
+
+            if (digit >= '0' && digit <= '9') {
+                value = value * 16 + (digit - '0');
+            } else if ((digit | 0x20) >= 'a' && (digit | 0x20) <= 'f') {
+                value = value * 16 + ((digit | 0x20) - 'a' + 10);
+            } else {
+                throw std::runtime_error("PatternCompiler::ParseHex(LRef<U64>): Invalid hex code point in pattern!");
+            }
+
+            if (value > 0x10FFFF) {
+                throw std::runtime_error("PatternCompiler::ParseHex(LRef<U64>): Invalid hex code point in pattern!");
+            }
+        }
+
+        ++position;
+
+        return value;
+    }
+
+    consteval Void AddBoundary(ConstLRef<U32> codePoint) {
+        U64 index = 0;
+
+        while (index < _boundariesCount && _boundaries[index] < codePoint) {
+            ++index;
+        }
+
+        if (index < _boundariesCount && _boundaries[index] == codePoint) {
+            return;
+        }
+
+        if (_boundariesCount == PatternMaxBoundaries) {
+            throw std::runtime_error("PatternCompiler::AddBoundary(ConstLRef<U32>): Too many ranges in pattern!");
+        }
+
+        for (auto i = _boundariesCount; i > index; --i) {
+            _boundaries[i] = _boundaries[i - 1];
+        }
+
+        _boundaries[index] = codePoint;
+
+        ++_boundariesCount;
+    }
+
+    consteval Void BuildClasses() {
+        AddBoundary(0);
+
+        U32 usedProperties = 0;
+
+        for (U64 index = 0; index < _symbolSetsCount; ++index) {
+            auto &symbolSet = _symbolSets[index];
+
+            for (U64 i = 0; i < symbolSet.RangesCount(); ++i) {
+                AddBoundary(symbolSet.RangeFirst(i));
+
+                if (symbolSet.RangeLast(i) < 0x10FFFF) {
+                    AddBoundary(symbolSet.RangeLast(i) + 1);
+                }
+            }
+
+            usedProperties |= symbolSet.Properties();
+        }
+
+        for (auto property : PatternProperties) {
+            if ((usedProperties & property) != 0) {
+                _properties[_propertiesCount++] = property;
+            }
+        }
+
+        auto rawClassesCount = _boundariesCount << _propertiesCount;
+
+        if (rawClassesCount > PatternMaxRawClasses) {
+            throw std::runtime_error("PatternCompiler::BuildClasses(): Too many symbol classes in pattern!");
+        }
+
+        for (U64 rawClass = 0; rawClass < rawClassesCount; ++rawClass) {
+            auto codePoint = _boundaries[rawClass >> _propertiesCount];
+
+            U32 properties = 0;
+
+            for (U64 index = 0; index < _propertiesCount; ++index) {
+                if (((rawClass >> index) & 1) != 0) {
+                    properties |= _properties[index];
+                }
+            }
+
+            U64 signature = 0;
+
+            for (U64 index = 0; index < _symbolSetsCount; ++index) {
+                if (_symbolSets[index].Contains(codePoint, properties)) {
+                    signature |= 1ULL << index;
+                }
+            }
+
+            U64 symbolClass = 0;
+
+            while (symbolClass < _classesCount && _classSignatures[symbolClass] != signature) {
+                ++symbolClass;
+            }
+
+            if (symbolClass == _classesCount) {
+                if (_classesCount == PatternMaxClasses) {
+                    throw std::runtime_error("PatternCompiler::BuildClasses(): Too many symbol classes in pattern!");
+                }
+
+                _classSignatures[_classesCount++] = signature;
+            }
+
+            _rawClasses[rawClass] = StaticCast<U8>(symbolClass);
+        }
+
+        for (U32 codePoint = 0; codePoint < 128; ++codePoint) {
+            U64 interval = 0;
+
+            while (interval + 1 < _boundariesCount && _boundaries[interval + 1] <= codePoint) {
+                ++interval;
+            }
+
+            U64 rawClass = interval << _propertiesCount;
+
+            for (U64 index = 0; index < _propertiesCount; ++index) {
+                if ((UnicodeTablesASCIIRecords[codePoint] & _properties[index]) != 0) {
+                    rawClass |= 1ULL << index;
+                }
+            }
+
+            _asciiClasses[codePoint] = _rawClasses[rawClass];
+        }
+    }
+
+    consteval Void Close(LRef<PatternStateSet> stateSet) const {
+        U32 stack[PatternMaxNFAStates] = {};
+
+        U64 stackSize = 0;
+
+        for (U32 state = 0; state < _nfaStatesCount; ++state) {
+            if (stateSet.Contains(state)) {
+                stack[stackSize++] = state;
+            }
+        }
+
+        while (stackSize > 0) {
+            auto state = stack[--stackSize];
+
+            for (U64 index = 0; index < 2; ++index) {
+                auto next = _nfaStates[state].Epsilon(index);
+
+                if (next != PatternNone && !stateSet.Contains(next)) {
+                    stateSet.Add(next);
+
+                    stack[stackSize++] = next;
+                }
+            }
+        }
+    }
+
+    consteval U64 AddDFAState(ConstLRef<PatternStateSet> stateSet) {
+        for (U64 index = 0; index < _dfaStatesCount; ++index) {
+            if (_dfaStateSets[index] == stateSet) {
+                return index;
+            }
+        }
+
+        if (_dfaStatesCount == PatternMaxDFAStates) {
+            throw std::runtime_error("PatternCompiler::AddDFAState(ConstLRef<PatternStateSet>): Too many DFA states for pattern!");
+        }
+
+        _dfaStateSets[_dfaStatesCount] = stateSet;
+
+        _accepting[_dfaStatesCount] = stateSet.Contains(_nfaAccept);
+
+        return _dfaStatesCount++;
+    }
+
+    consteval Void BuildDFA() {
+        // state 0 is dead state, state 1 is start state
+        AddDFAState(PatternStateSet());
+
+        PatternStateSet startSet;
+
+        startSet.Add(_nfaStart);
+
+        Close(startSet);
+
+        AddDFAState(startSet);
+
+        for (U64 dfaState = 1; dfaState < _dfaStatesCount; ++dfaState) {
+            for (U64 symbolClass = 0; symbolClass < _classesCount; ++symbolClass) {
+                PatternStateSet nextSet;
+
+                for (U32 state = 0; state < _nfaStatesCount; ++state) {
+                    auto &nfaState = _nfaStates[state];
+
+                    if (nfaState.SymbolSet() != PatternNone
+                     && _dfaStateSets[dfaState].Contains(state)
+                     && ((_classSignatures[symbolClass] >> nfaState.SymbolSet()) & 1) != 0) {
+                        nextSet.Add(nfaState.Next());
+                    }
+                }
+
+                Close(nextSet);
+
+                _transitions[dfaState][symbolClass] = StaticCast<U8>(AddDFAState(nextSet));
+            }
+        }
+    }
+
+public:
+
+    inline constexpr U64 DFAStatesCount() const {
+        return _dfaStatesCount;
+    }
+
+    inline constexpr U64 ClassesCount() const {
+        return _classesCount;
+    }
+
+    inline constexpr U64 BoundariesCount() const {
+        return _boundariesCount;
+    }
+
+    inline constexpr U64 PropertiesCount() const {
+        return _propertiesCount;
+    }
+
+    inline constexpr U8 Transition(ConstLRef<U64> state, ConstLRef<U64> symbolClass) const {
+        return _transitions[state][symbolClass];
+    }
+
+    inline constexpr Bool IsAccepting(ConstLRef<U64> state) const {
+        return _accepting[state];
+    }
+
+    inline constexpr U8 ASCIIClass(ConstLRef<U64> codePoint) const {
+        return _asciiClasses[codePoint];
+    }
+
+    inline constexpr U32 Boundary(ConstLRef<U64> index) const {
+        return _boundaries[index];
+    }
+
+    inline constexpr U8 RawClass(ConstLRef<U64> index) const {
+        return _rawClasses[index];
+    }
+
+    inline constexpr U32 Property(ConstLRef<U64> index) const {
+        return _properties[index];
+    }
+
+private:
+
+    UStringView _pattern;
+
+    PatternNFAState _nfaStates[PatternMaxNFAStates];
+
+    U64 _nfaStatesCount;
+
+    U32 _nfaStart;
+
+    U32 _nfaAccept;
+
+    PatternSymbolSet _symbolSets[PatternMaxSymbolSets];
+
+    U64 _symbolSetsCount;
+
+    U32 _boundaries[PatternMaxBoundaries];
+
+    U64 _boundariesCount;
+
+    U32 _properties[std::size(PatternProperties)];
+
+    U64 _propertiesCount;
+
+    U8 _rawClasses[PatternMaxRawClasses];
+
+    U64 _classSignatures[PatternMaxClasses];
+
+    U64 _classesCount;
+
+    U8 _asciiClasses[128];
+
+    PatternStateSet _dfaStateSets[PatternMaxDFAStates];
+
+    U64 _dfaStatesCount;
+
+    U8 _transitions[PatternMaxDFAStates][PatternMaxClasses];
+
+    Bool _accepting[PatternMaxDFAStates];
+};
+
+/**
+ * Compiled DFA with tables of exact size
+ * @tparam StatesV States count
+ * @tparam ClassesV Symbol classes count
+ * @tparam BoundariesV Intervals count
+ * @tparam PropertiesV Used properties count
+ */
+template<U64 StatesV, U64 ClassesV, U64 BoundariesV, U64 PropertiesV>
+class PatternAutomaton {
+public:
+
+    inline static constexpr U8 DeadState = 0;
+
+    inline static constexpr U8 StartState = 1;
+
+    inline static constexpr U64 StatesCount = StatesV;
+
+public:
+
+    consteval PatternAutomaton(ConstLRef<PatternCompiler> compiler)
+            : _transitions{}, _accepting{}, _asciiClasses{}, _boundaries{}, _rawClasses{}, _properties{} {
+        for (U64 state = 0; state < StatesV; ++state) {
+            for (U64 symbolClass = 0; symbolClass < ClassesV; ++symbolClass) {
+                _transitions[state * ClassesV + symbolClass] = compiler.Transition(state, symbolClass);
+            }
+
+            _accepting[state] = compiler.IsAccepting(state);
+        }
+
+        for (U64 codePoint = 0; codePoint < 128; ++codePoint) {
+            _asciiClasses[codePoint] = compiler.ASCIIClass(codePoint);
+        }
+
+        for (U64 index = 0; index < BoundariesV; ++index) {
+            _boundaries[index] = compiler.Boundary(index);
+        }
+
+        for (U64 index = 0; index < (BoundariesV << PropertiesV); ++index) {
+            _rawClasses[index] = compiler.RawClass(index);
+        }
+
+        for (U64 index = 0; index < PropertiesV; ++index) {
+            _properties[index] = compiler.Property(index);
+        }
+    }
+
+public:
+
+    inline constexpr U8 ClassOf(ConstLRef<U32> codePoint) const {
+        if (codePoint < 128) {
+            return _asciiClasses[codePoint];
+        }
+
+        U64 low = 0, high = BoundariesV;
+
+        while (high - low > 1) {
+            auto middle = (low + high) / 2;
+
+            if (_boundaries[middle] <= codePoint) {
+                low = middle;
+            } else {
+                high = middle;
+            }
+        }
+
+        auto rawClass = low << PropertiesV;
+
+        if constexpr (PropertiesV > 0) {
+            auto properties = UnicodePropertiesOf(codePoint);
+
+            for (U64 index = 0; index < PropertiesV; ++index) {
+                if ((properties & _properties[index]) != 0) {
+                    rawClass |= 1ULL << index;
+                }
+            }
+        }
+
+        return _rawClasses[rawClass];
+    }
+
+    inline constexpr U8 Next(ConstLRef<U8> state, ConstLRef<U32> codePoint) const {
+        if (codePoint > 0x10FFFF) {
+            return DeadState;
+        }
+
+        return _transitions[state * ClassesV + ClassOf(codePoint)];
+    }
+
+    inline constexpr Bool IsAccepting(ConstLRef<U8> state) const {
+        return _accepting[state];
+    }
+
+private:
+
+    U8 _transitions[StatesV * ClassesV];
+
+    Bool _accepting[StatesV];
+
+    U8 _asciiClasses[128];
+
+    U32 _boundaries[BoundariesV];
+
+    U8 _rawClasses[BoundariesV << PropertiesV];
+
+    U32 _properties[PropertiesV > 0 ? PropertiesV : 1];
+};
+
+class PatternMatch {
+public:
+
+    constexpr PatternMatch()
+            : _position(0), _size(0), _found(false) {}
+
+    constexpr PatternMatch(ConstLRef<U64> position, ConstLRef<U64> size)
+            : _position(position), _size(size), _found(true) {}
+
+public:
+
+    inline constexpr U64 Position() const {
+        return _position;
+    }
+
+    inline constexpr U64 Size() const {
+        return _size;
+    }
+
+    inline constexpr U64 End() const {
+        return _position + _size;
+    }
+
+    inline constexpr Bool Found() const {
+        return _found;
+    }
+
+public:
+
+    inline constexpr Bool operator==(ConstLRef<PatternMatch> match) const {
+        return _found == match._found && (!_found || (_position == match._position && _size == match._size));
+    }
+
+    inline constexpr Bool operator!=(ConstLRef<PatternMatch> match) const {
+        return !(*this == match);
+    }
+
+private:
+
+    U64 _position;
+
+    U64 _size;
+
+    Bool _found;
+};
+
+inline constexpr U32 PatternNextCodePoint(ConstPtr<USymbol> symbols, ConstLRef<U64>, LRef<U64> position) {
+    return symbols[position++].CodePoint();
+}
+
+inline constexpr U32 PatternNextCodePoint(ConstPtr<U8> bytes, ConstLRef<U64> size, LRef<U64> position) {
+    U32 codePoint;
+
+    position += FromUTF8(bytes + position, size - position, codePoint);
+
+    return codePoint;
+}
+
+/**
+ * Finding longest match starting at position
+ * @param automaton Automaton
+ * @param data Symbols or UTF-8 bytes
+ * @param size Size of data
+ * @param position Start position
+ * @return Match
+ */
+template<typename AutomatonT, typename SymbolT>
+inline constexpr PatternMatch PatternMatchPrefix(ConstLRef<AutomatonT> automaton, ConstPtr<SymbolT> data, ConstLRef<U64> size, U64 position) {
+    auto state = AutomatonT::StartState;
+
+    auto start = position;
+
+    PatternMatch match;
+
+    if (automaton.IsAccepting(state)) {
+        match = PatternMatch(start, 0);
+    }
+
+    while (position < size) {
+        state = automaton.Next(state, PatternNextCodePoint(data, size, position));
+
+        if (state == AutomatonT::DeadState) {
+            break;
+        }
+
+        if (automaton.IsAccepting(state)) {
+            match = PatternMatch(start, position - start);
+        }
+    }
+
+    return match;
+}
+
+/**
+ * Finding leftmost-longest match starting at or after position
+ *
+ * Every position starts DFA thread until first match, threads are ordered by start position.
+ * Threads in equal DFA state have equal future, so only thread with leftmost start is kept and
+ * every symbol is processed by at most one thread per DFA state. After match only threads with earlier or equal start are kept
+ * @param automaton Automaton
+ * @param data Symbols or UTF-8 bytes
+ * @param size Size of data
+ * @param position Start position
+ * @return Match
+ */
+template<typename AutomatonT, typename SymbolT>
+inline constexpr PatternMatch PatternSearch(ConstLRef<AutomatonT> automaton, ConstPtr<SymbolT> data, ConstLRef<U64> size, U64 position) {
+    U8 states[AutomatonT::StatesCount] = {};
+
+    U64 starts[AutomatonT::StatesCount] = {};
+
+    // step of last thread in DFA state, for skipping threads with later start
+    U64 stateSteps[AutomatonT::StatesCount] = {};
+
+    states[0] = AutomatonT::StartState;
+
+    starts[0] = position;
+
+    U64 threadsCount = 1;
+
+    PatternMatch match;
+
+    if (automaton.IsAccepting(AutomatonT::StartState)) {
+        match = PatternMatch(position, 0);
+    }
+
+    for (U64 step = 1; position < size && threadsCount > 0; ++step) {
+        // while only thread of current position is alive, symbols which can't start match are skipped
+        if (threadsCount == 1 && starts[0] == position && !match.Found()) {
+            auto nextPosition = position;
+
+            while (position < size && automaton.Next(AutomatonT::StartState, PatternNextCodePoint(data, size, nextPosition)) == AutomatonT::DeadState) {
+                position = nextPosition;
+            }
+
+            if (position == size) {
+                break;
+            }
+
+            starts[0] = position;
+        }
+
+        auto codePoint = PatternNextCodePoint(data, size, position);
+
+        U64 nextThreadsCount = 0;
+
+        auto isAccepted = false;
+
+        for (U64 index = 0; index < threadsCount; ++index) {
+            // threads starting after found match can't give leftmost match
+            if (match.Found() && starts[index] > match.Position()) {
+                break;
+            }
+
+            auto state = automaton.Next(states[index], codePoint);
+
+            if (state == AutomatonT::DeadState || stateSteps[state] == step) {
+                continue;
+            }
+
+            stateSteps[state] = step;
+
+            states[nextThreadsCount] = state;
+
+            starts[nextThreadsCount] = starts[index];
+
+            ++nextThreadsCount;
+
+            if (!isAccepted && automaton.IsAccepting(state)) {
+                isAccepted = true;
+
+                match = PatternMatch(starts[index], position - starts[index]);
+            }
+        }
+
+        if (!match.Found() && stateSteps[AutomatonT::StartState] != step) {
+            states[nextThreadsCount] = AutomatonT::StartState;
+
+            starts[nextThreadsCount] = position;
+
+            ++nextThreadsCount;
+        }
+
+        threadsCount = nextThreadsCount;
+    }
+
+    return match;
+}
+
+template<typename AutomatonT, typename SymbolT>
+class PatternMatchIterator {
+public:
+
+    constexpr PatternMatchIterator()
+            : _automaton(nullptr), _data(nullptr), _size(0) {}
+
+    constexpr PatternMatchIterator(ConstPtr<AutomatonT> automaton, ConstPtr<SymbolT> data, ConstLRef<U64> size)
+            : _automaton(automaton), _data(data), _size(size), _match(PatternSearch(*automaton, data, size, 0)) {}
+
+public:
+
+    inline constexpr ConstLRef<PatternMatch> operator*() const {
+        return _match;
+    }
+
+    inline constexpr ConstPtr<PatternMatch> operator->() const {
+        return &_match;
+    }
+
+    inline constexpr LRef<PatternMatchIterator<AutomatonT, SymbolT>> operator++() {
+        auto position = _match.End();
+
+        // empty match is followed by search from next symbol
+        if (_match.Size() == 0) {
+            if (position >= _size) {
+                _match = PatternMatch();
+
+                return *this;
+            }
+
+            PatternNextCodePoint(_data, _size, position);
+        }
+
+        _match = PatternSearch(*_automaton, _data, _size, position);
+
+        return *this;
+    }
+
+    inline constexpr Bool operator==(ConstLRef<PatternMatchIterator<AutomatonT, SymbolT>> iterator) const {
+        return _match == iterator._match;
+    }
+
+    inline constexpr Bool operator!=(ConstLRef<PatternMatchIterator<AutomatonT, SymbolT>> iterator) const {
+        return !(*this == iterator);
+    }
+
+private:
+
+    ConstPtr<AutomatonT> _automaton;
+
+    ConstPtr<SymbolT> _data;
+
+    U64 _size;
+
+    PatternMatch _match;
+};
+
+/**
+ * Lazy range of non-overlapping matches
+ */
+template<typename AutomatonT, typename SymbolT>
+class PatternMatchRange {
+public:
+
+    constexpr PatternMatchRange(ConstPtr<AutomatonT> automaton, ConstPtr<SymbolT> data, ConstLRef<U64> size)
+            : _automaton(automaton), _data(data), _size(size) {}
+
+public:
+
+    inline constexpr PatternMatchIterator<AutomatonT, SymbolT> begin() const {
+        return PatternMatchIterator<AutomatonT, SymbolT>(_automaton, _data, _size);
+    }
+
+    inline constexpr PatternMatchIterator<AutomatonT, SymbolT> end() const {
+        return PatternMatchIterator<AutomatonT, SymbolT>();
+    }
+
+private:
+
+    ConstPtr<AutomatonT> _automaton;
+
+    ConstPtr<SymbolT> _data;
+
+    U64 _size;
+};
+
+/**
+ * Pattern compiled at compile time
+ * @tparam PatternV Pattern
+ */
+template<UStringLiteral PatternV>
+class Pattern {
+private:
+
+    inline static constexpr PatternCompiler Compiler = PatternCompiler(UStringView(UStringLiteralSymbols<PatternV>.Data(), PatternV.Decode(nullptr)));
+
+public:
+
+    using AutomatonType = PatternAutomaton<Compiler.DFAStatesCount(), Compiler.ClassesCount(), Compiler.BoundariesCount(), Compiler.PropertiesCount()>;
+
+    inline static constexpr AutomatonType Automaton = AutomatonType(Compiler);
+
+public:
+
+    constexpr Pattern() = default;
+
+public:
+
+    /**
+     * Matching whole string
+     * @param string String
+     * @return Is string matches pattern
+     */
+    inline constexpr Bool Match(UStringView string) const {
+        return MatchWhole(string.Data(), string.Size());
+    }
+
+    inline constexpr Bool Match(ConstPtr<U8> bytes, ConstLRef<U64> size) const {
+        return MatchWhole(bytes, size);
+    }
+
+    /**
+     * Finding longest match starting at position
+     * @param string String
+     * @param position Position
+     * @return Match
+     */
+    inline constexpr PatternMatch MatchPrefix(UStringView string, ConstLRef<U64> position = 0) const {
+        return PatternMatchPrefix(Automaton, string.Data(), string.Size(), position);
+    }
+
+    inline constexpr PatternMatch MatchPrefix(ConstPtr<U8> bytes, ConstLRef<U64> size, ConstLRef<U64> position = 0) const {
+        return PatternMatchPrefix(Automaton, bytes, size, position);
+    }
+
+    /**
+     * Finding leftmost longest match starting at or after position
+     * @param string String
+     * @param position Position
+     * @return Match
+     */
+    inline constexpr PatternMatch Search(UStringView string, ConstLRef<U64> position = 0) const {
+        return PatternSearch(Automaton, string.Data(), string.Size(), position);
+    }
+
+    inline constexpr PatternMatch Search(ConstPtr<U8> bytes, ConstLRef<U64> size, ConstLRef<U64> position = 0) const {
+        return PatternSearch(Automaton, bytes, size, position);
+    }
+
+    /**
+     * Finding all non-overlapping matches lazily (positions in symbols)
+     * @param string String (must outlive range)
+     * @return Range of matches
+     */
+    inline constexpr PatternMatchRange<AutomatonType, USymbol> FindAll(UStringView string) const {
+        return PatternMatchRange<AutomatonType, USymbol>(&Automaton, string.Data(), string.Size());
+    }
+
+    /**
+     * Finding all non-overlapping matches lazily (positions in bytes)
+     * @param bytes UTF-8 bytes (must outlive range)
+     * @param size Bytes count
+     * @return Range of matches
+     */
+    inline constexpr PatternMatchRange<AutomatonType, U8> FindAll(ConstPtr<U8> bytes, ConstLRef<U64> size) const {
+        return PatternMatchRange<AutomatonType, U8>(&Automaton, bytes, size);
+    }
+
+private:
+
+    template<typename SymbolT>
+    static inline constexpr Bool MatchWhole(ConstPtr<SymbolT> data, ConstLRef<U64> size) {
+        auto state = AutomatonType::StartState;
+
+        for (U64 position = 0; position < size;) {
+            state = Automaton.Next(state, PatternNextCodePoint(data, size, position));
+
+            if (state == AutomatonType::DeadState) {
+                return false;
+            }
+        }
+
+        return Automaton.IsAccepting(state);
+    }
+};
+
+#endif //GSCROSSPLATFORM_PATTERN_H
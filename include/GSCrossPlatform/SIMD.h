@@ -0,0 +1,401 @@
+#ifndef GSCROSSPLATFORM_SIMD_H
+#define GSCROSSPLATFORM_SIMD_H
+
+#include <GSCrossPlatform/Types.h>
+
+/**
+ * Thin wrapper over byte vectors of available SIMD instruction set
+ *
+ * GS_SIMD_VECTOR is defined when any instruction set is available, otherwise callers must use scalar code,
+ * GS_SIMD_LOOKUP is defined when byte shuffles are available (AVX2, SSE4 or NEON)
+ */
+#if defined(GS_SIMD_AVX2)
+
+    #include <immintrin.h>
+
+    #define GS_SIMD_VECTOR
+
+using SIMDVector = __m256i;
+
+    #define GS_SIMD_LOOKUP
+
+#elif defined(GS_SIMD_SSE2)
+
+    #include <emmintrin.h>
+
+    #if defined(GS_SIMD_SSE4)
+
+        #include <smmintrin.h>
+
+    #endif
+
+    #define GS_SIMD_VECTOR
+
+using SIMDVector = __m128i;
+
+    #if defined(GS_SIMD_SSE4)
+
+        #define GS_SIMD_LOOKUP
+
+    #endif
+
+#elif defined(GS_SIMD_NEON)
+
+    #include <arm_neon.h>
+
+    #define GS_SIMD_VECTOR
+
+using SIMDVector = uint8x16_t;
+
+    #define GS_SIMD_LOOKUP
+
+#endif
+
+#if defined(GS_SIMD_VECTOR)
+
+inline constexpr U64 SIMDVectorSize = sizeof(SIMDVector);
+
+inline SIMDVector SIMDLoad(ConstPtr<U8> bytes) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bytes));
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(bytes));
+
+#else
+
+    return vld1q_u8(bytes);
+
+#endif
+}
+
+inline Void SIMDStore(Ptr<U8> bytes, SIMDVector vector) {
+#if defined(GS_SIMD_AVX2)
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(bytes), vector);
+
+#elif defined(GS_SIMD_SSE2)
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(bytes), vector);
+
+#else
+
+    vst1q_u8(bytes, vector);
+
+#endif
+}
+
+inline SIMDVector SIMDSplat(U8 byte) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_set1_epi8(StaticCast<C>(byte));
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_set1_epi8(StaticCast<C>(byte));
+
+#else
+
+    return vdupq_n_u8(byte);
+
+#endif
+}
+
+inline SIMDVector SIMDOr(SIMDVector first, SIMDVector second) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_or_si256(first, second);
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_or_si128(first, second);
+
+#else
+
+    return vorrq_u8(first, second);
+
+#endif
+}
+
+inline SIMDVector SIMDAnd(SIMDVector first, SIMDVector second) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_and_si256(first, second);
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_and_si128(first, second);
+
+#else
+
+    return vandq_u8(first, second);
+
+#endif
+}
+
+inline SIMDVector SIMDEqual(SIMDVector first, SIMDVector second) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_cmpeq_epi8(first, second);
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_cmpeq_epi8(first, second);
+
+#else
+
+    return vceqq_u8(first, second);
+
+#endif
+}
+
+/**
+ * Checking bytes in range [lower, upper] (unsigned)
+ * @param vector Vector
+ * @param lower Lower bound
+ * @param upper Upper bound
+ * @return Mask vector (0xFF for bytes in range)
+ */
+inline SIMDVector SIMDInRange(SIMDVector vector, U8 lower, U8 upper) {
+#if defined(GS_SIMD_AVX2)
+
+    auto shifted = _mm256_sub_epi8(vector, _mm256_set1_epi8(StaticCast<C>(lower)));
+
+    return _mm256_cmpeq_epi8(_mm256_min_epu8(shifted, _mm256_set1_epi8(StaticCast<C>(upper - lower))), shifted);
+
+#elif defined(GS_SIMD_SSE2)
+
+    auto shifted = _mm_sub_epi8(vector, _mm_set1_epi8(StaticCast<C>(lower)));
+
+    return _mm_cmpeq_epi8(_mm_min_epu8(shifted, _mm_set1_epi8(StaticCast<C>(upper - lower))), shifted);
+
+#else
+
+    return vcleq_u8(vsubq_u8(vector, vdupq_n_u8(lower)), vdupq_n_u8(upper - lower));
+
+#endif
+}
+
+/**
+ * Collecting high bits of bytes into bit mask
+ * @param vector Vector
+ * @return Bit mask (bit i for byte i)
+ */
+inline U64 SIMDMoveMask(SIMDVector vector) {
+#if defined(GS_SIMD_AVX2)
+
+    return StaticCast<U32>(_mm256_movemask_epi8(vector));
+
+#elif defined(GS_SIMD_SSE2)
+
+    return StaticCast<U32>(_mm_movemask_epi8(vector));
+
+#else
+
+    const int8x16_t shifts = {0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+
+    auto bits = vshlq_u8(vshrq_n_u8(vector, 7), shifts);
+
+    return StaticCast<U64>(vaddv_u8(vget_low_u8(bits))) | (StaticCast<U64>(vaddv_u8(vget_high_u8(bits))) << 8);
+
+#endif
+}
+
+inline SIMDVector SIMDXor(SIMDVector first, SIMDVector second) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_xor_si256(first, second);
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_xor_si128(first, second);
+
+#else
+
+    return veorq_u8(first, second);
+
+#endif
+}
+
+/**
+ * Subtracting bytes with unsigned saturation
+ * @param first First vector
+ * @param second Second vector
+ * @return Vector of max(first - second, 0)
+ */
+inline SIMDVector SIMDSubtractSaturated(SIMDVector first, SIMDVector second) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_subs_epu8(first, second);
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_subs_epu8(first, second);
+
+#else
+
+    return vqsubq_u8(first, second);
+
+#endif
+}
+
+/**
+ * Shifting each byte right by 4 bits (high nibbles)
+ * @param vector Vector
+ * @return Vector of high nibbles
+ */
+inline SIMDVector SIMDHighNibbles(SIMDVector vector) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_and_si256(_mm256_srli_epi16(vector, 4), _mm256_set1_epi8(0x0F));
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_and_si128(_mm_srli_epi16(vector, 4), _mm_set1_epi8(0x0F));
+
+#else
+
+    return vshrq_n_u8(vector, 4);
+
+#endif
+}
+
+inline SIMDVector SIMDSubtract(SIMDVector first, SIMDVector second) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_sub_epi8(first, second);
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_sub_epi8(first, second);
+
+#else
+
+    return vsubq_u8(first, second);
+
+#endif
+}
+
+/**
+ * Summing bytes of vector (unsigned), lane sums fit in 32 bits (also available on 32-bit x86)
+ * @param vector Vector
+ * @return Sum
+ */
+inline U64 SIMDSumBytes(SIMDVector vector) {
+#if defined(GS_SIMD_AVX2)
+
+    auto sums = _mm256_sad_epu8(vector, _mm256_setzero_si256());
+
+    auto halfSums = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+
+    return StaticCast<U64>(_mm_cvtsi128_si32(halfSums)) + StaticCast<U64>(_mm_cvtsi128_si32(_mm_unpackhi_epi64(halfSums, halfSums)));
+
+#elif defined(GS_SIMD_SSE2)
+
+    auto sums = _mm_sad_epu8(vector, _mm_setzero_si128());
+
+    return StaticCast<U64>(_mm_cvtsi128_si32(sums)) + StaticCast<U64>(_mm_cvtsi128_si32(_mm_unpackhi_epi64(sums, sums)));
+
+#else
+
+    return vaddlvq_u8(vector);
+
+#endif
+}
+
+inline Bool SIMDIsZero(SIMDVector vector) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_testz_si256(vector, vector) != 0;
+
+#elif defined(GS_SIMD_SSE4)
+
+    return _mm_testz_si128(vector, vector) != 0;
+
+#elif defined(GS_SIMD_SSE2)
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(vector, _mm_setzero_si128())) == 0xFFFF;
+
+#else
+
+    return vmaxvq_u8(vector) == 0;
+
+#endif
+}
+
+#if defined(GS_SIMD_LOOKUP)
+
+/**
+ * Loading 16 bytes table for SIMDLookup (repeated in each 128-bit lane)
+ * @param table Table
+ * @return Table vector
+ */
+inline SIMDVector SIMDTable(Const<U8> (&table)[16]) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(table)));
+
+#elif defined(GS_SIMD_SSE4)
+
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(table));
+
+#else
+
+    return vld1q_u8(table);
+
+#endif
+}
+
+/**
+ * Looking up bytes in 16 bytes table
+ * @param table Table vector from SIMDTable
+ * @param indices Indices (0..15)
+ * @return Vector of table[indices[i]]
+ */
+inline SIMDVector SIMDLookup(SIMDVector table, SIMDVector indices) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_shuffle_epi8(table, indices);
+
+#elif defined(GS_SIMD_SSE4)
+
+    return _mm_shuffle_epi8(table, indices);
+
+#else
+
+    return vqtbl1q_u8(table, indices);
+
+#endif
+}
+
+/**
+ * Shifting bytes of vector by ShiftV positions, filling with last bytes of previous vector
+ * @tparam ShiftV Shift (1..15)
+ * @param current Current vector
+ * @param previous Previous vector
+ * @return Vector of bytes at positions i - ShiftV
+ */
+template<I32 ShiftV>
+inline SIMDVector SIMDPrevious(SIMDVector current, SIMDVector previous) {
+#if defined(GS_SIMD_AVX2)
+
+    return _mm256_alignr_epi8(current, _mm256_permute2x128_si256(previous, current, 0x21), 16 - ShiftV);
+
+#elif defined(GS_SIMD_SSE4)
+
+    return _mm_alignr_epi8(current, previous, 16 - ShiftV);
+
+#else
+
+    return vextq_u8(previous, current, 16 - ShiftV);
+
+#endif
+}
+
+#endif
+
+#endif
+
+#endif //GSCROSSPLATFORM_SIMD_H
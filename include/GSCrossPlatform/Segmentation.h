@@ -0,0 +1,435 @@
+#ifndef GSCROSSPLATFORM_SEGMENTATION_H
+#define GSCROSSPLATFORM_SEGMENTATION_H
+
+#include <GSCrossPlatform/UString.h>
+#include <GSCrossPlatform/UnicodeTables.h>
+
+/**
+ * Text segmentation by Unicode Standard Annex #29 (Unicode Text Segmentation)
+ */
+
+/**
+ * Finding next extended grapheme cluster boundary
+ * @param string String
+ * @param position Position of boundary
+ * @return Position of next boundary
+ */
+inline constexpr U64 NextGraphemeBoundary(UStringView string, U64 position) {
+    auto symbols = string.Data();
+
+    auto size = string.Size();
+
+    if (position >= size) {
+        return size;
+    }
+
+    auto previous = GraphemeBreakOf(symbols[position].CodePoint());
+
+    U64 regionalIndicatorsCount = previous == GraphemeBreak::RegionalIndicator ? 1 : 0;
+
+    // 0 - no emoji sequence, 1 - ExtPict Extend*, 2 - ExtPict Extend* ZWJ
+    U8 emojiState = IsExtendedPictographic(symbols[position].CodePoint()) ? 1 : 0;
+
+    for (auto index = position + 1; index < size; ++index) {
+        auto codePoint = symbols[index].CodePoint();
+
+        auto current = GraphemeBreakOf(codePoint);
+
+        auto isPictographic = IsExtendedPictographic(codePoint);
+
+        Bool isBoundary;
+
+        if (previous == GraphemeBreak::CR && current == GraphemeBreak::LF) {
+            isBoundary = false;
+        } else if (previous == GraphemeBreak::CR || previous == GraphemeBreak::LF || previous == GraphemeBreak::Control
+                || current == GraphemeBreak::CR || current == GraphemeBreak::LF || current == GraphemeBreak::Control) {
+            isBoundary = true;
+        } else if (previous == GraphemeBreak::L
+                && (current == GraphemeBreak::L || current == GraphemeBreak::V || current == GraphemeBreak::LV || current == GraphemeBreak::LVT)) {
+            isBoundary = false;
+        } else if ((previous == GraphemeBreak::LV || previous == GraphemeBreak::V)
+                && (current == GraphemeBreak::V || current == GraphemeBreak::T)) {
+            isBoundary = false;
+        } else if ((previous == GraphemeBreak::LVT || previous == GraphemeBreak::T) && current == GraphemeBreak::T) {
+            isBoundary = false;
+        } else if (current == GraphemeBreak::Extend || current == GraphemeBreak::ZWJ || current == GraphemeBreak::SpacingMark) {
+            isBoundary = false;
+        } else if (previous == GraphemeBreak::Prepend) {
+            isBoundary = false;
+        } else if (emojiState == 2 && isPictographic) {
+            isBoundary = false;
+        } else if (previous == GraphemeBreak::RegionalIndicator && current == GraphemeBreak::RegionalIndicator) {
+            isBoundary = regionalIndicatorsCount % 2 == 0;
+        } else {
+            isBoundary = true;
+        }
+
+        if (isBoundary) {
+            return index;
+        }
+
+        regionalIndicatorsCount = current == GraphemeBreak::RegionalIndicator ? regionalIndicatorsCount + 1 : 0;
+
+        if (isPictographic) {
+            emojiState = 1;
+        } else if (emojiState == 1 && current == GraphemeBreak::Extend) {
+            emojiState = 1;
+        } else if (emojiState == 1 && current == GraphemeBreak::ZWJ) {
+            emojiState = 2;
+        } else {
+            emojiState = 0;
+        }
+
+        previous = current;
+    }
+
+    return size;
+}
+
+inline constexpr Bool IsWordBreakIgnorable(ConstLRef<WordBreak> property) {
+    return property == WordBreak::Extend || property == WordBreak::Format || property == WordBreak::ZWJ;
+}
+
+inline constexpr Bool IsAHLetter(ConstLRef<WordBreak> property) {
+    return property == WordBreak::ALetter || property == WordBreak::HebrewLetter;
+}
+
+inline constexpr Bool IsMidNumLetQ(ConstLRef<WordBreak> property) {
+    return property == WordBreak::MidNumLet || property == WordBreak::SingleQuote;
+}
+
+/**
+ * Finding next word boundary
+ * @param string String
+ * @param position Position of boundary
+ * @return Position of next boundary
+ */
+inline constexpr U64 NextWordBoundary(UStringView string, U64 position) {
+    auto symbols = string.Data();
+
+    auto size = string.Size();
+
+    if (position >= size) {
+        return size;
+    }
+
+    // previous properties skipping Extend, Format and ZWJ (WB4)
+    auto previous = WordBreakOf(symbols[position].CodePoint());
+
+    auto beforePrevious = WordBreak::Other;
+
+    auto rawPrevious = previous;
+
+    U64 regionalIndicatorsCount = previous == WordBreak::RegionalIndicator ? 1 : 0;
+
+    auto nextProperty = [&](U64 index) {
+        for (++index; index < size; ++index) {
+            auto property = WordBreakOf(symbols[index].CodePoint());
+
+            if (!IsWordBreakIgnorable(property)) {
+                return property;
+            }
+        }
+
+        return WordBreak::Other;
+    };
+
+    for (auto index = position + 1; index < size; ++index) {
+        auto codePoint = symbols[index].CodePoint();
+
+        auto current = WordBreakOf(codePoint);
+
+        Bool isBoundary;
+
+        if (rawPrevious == WordBreak::CR && current == WordBreak::LF) {
+            isBoundary = false;
+        } else if (rawPrevious == WordBreak::CR || rawPrevious == WordBreak::LF || rawPrevious == WordBreak::Newline
+                || current == WordBreak::CR || current == WordBreak::LF || current == WordBreak::Newline) {
+            isBoundary = true;
+        } else if (rawPrevious == WordBreak::ZWJ && IsExtendedPictographic(codePoint)) {
+            isBoundary = false;
+        } else if (rawPrevious == WordBreak::WSegSpace && current == WordBreak::WSegSpace) {
+            isBoundary = false;
+        } else if (IsWordBreakIgnorable(current)) {
+            rawPrevious = current;
+
+            continue;
+        } else if (IsAHLetter(previous) && IsAHLetter(current)) {
+            isBoundary = false;
+        } else if (IsAHLetter(previous)
+                && (current == WordBreak::MidLetter || IsMidNumLetQ(current))
+                && IsAHLetter(nextProperty(index))) {
+            isBoundary = false;
+        } else if (IsAHLetter(beforePrevious)
+                && (previous == WordBreak::MidLetter || IsMidNumLetQ(previous))
+                && IsAHLetter(current)) {
+            isBoundary = false;
+        } else if (previous == WordBreak::HebrewLetter && current == WordBreak::SingleQuote) {
+            isBoundary = false;
+        } else if (previous == WordBreak::HebrewLetter
+                && current == WordBreak::DoubleQuote
+                && nextProperty(index) == WordBreak::HebrewLetter) {
+            isBoundary = false;
+        } else if (beforePrevious == WordBreak::HebrewLetter
+                && previous == WordBreak::DoubleQuote
+                && current == WordBreak::HebrewLetter) {
+            isBoundary = false;
+        } else if ((previous == WordBreak::Numeric || IsAHLetter(previous)) && current == WordBreak::Numeric) {
+            isBoundary = false;
+        } else if (previous == WordBreak::Numeric && IsAHLetter(current)) {
+            isBoundary = false;
+        } else if (beforePrevious == WordBreak::Numeric
+                && (previous == WordBreak::MidNum || IsMidNumLetQ(previous))
+                && current == WordBreak::Numeric) {
+            isBoundary = false;
+        } else if (previous == WordBreak::Numeric
+                && (current == WordBreak::MidNum || IsMidNumLetQ(current))
+                && nextProperty(index) == WordBreak::Numeric) {
+            isBoundary = false;
+        } else if (previous == WordBreak::Katakana && current == WordBreak::Katakana) {
+            isBoundary = false;
+        } else if ((IsAHLetter(previous) || previous == WordBreak::Numeric || previous == WordBreak::Katakana || previous == WordBreak::ExtendNumLet)
+                && current == WordBreak::ExtendNumLet) {
+            isBoundary = false;
+        } else if (previous == WordBreak::ExtendNumLet
+                && (IsAHLetter(current) || current == WordBreak::Numeric || current == WordBreak::Katakana)) {
+            isBoundary = false;
+        } else if (previous == WordBreak::RegionalIndicator && current == WordBreak::RegionalIndicator) {
+            isBoundary = regionalIndicatorsCount % 2 == 0;
+        } else {
+            isBoundary = true;
+        }
+
+        if (isBoundary) {
+            return index;
+        }
+
+        regionalIndicatorsCount = current == WordBreak::RegionalIndicator ? regionalIndicatorsCount + 1 : 0;
+
+        beforePrevious = previous;
+
+        previous = current;
+
+        rawPrevious = current;
+    }
+
+    return size;
+}
+
+inline constexpr Bool IsSentenceBreakIgnorable(ConstLRef<SentenceBreak> property) {
+    return property == SentenceBreak::Extend || property == SentenceBreak::Format;
+}
+
+inline constexpr Bool IsParaSep(ConstLRef<SentenceBreak> property) {
+    return property == SentenceBreak::Sep || property == SentenceBreak::CR || property == SentenceBreak::LF;
+}
+
+inline constexpr Bool IsSATerm(ConstLRef<SentenceBreak> property) {
+    return property == SentenceBreak::ATerm || property == SentenceBreak::STerm;
+}
+
+/**
+ * Finding next sentence boundary
+ * @param string String
+ * @param position Position of boundary
+ * @return Position of next boundary
+ */
+inline constexpr U64 NextSentenceBoundary(UStringView string, U64 position) {
+    auto symbols = string.Data();
+
+    auto size = string.Size();
+
+    if (position >= size) {
+        return size;
+    }
+
+    // previous properties skipping Extend and Format (SB5)
+    auto previous = SentenceBreakOf(symbols[position].CodePoint());
+
+    auto beforePrevious = SentenceBreak::Other;
+
+    auto rawPrevious = previous;
+
+    // 0 - no terminator, 1 - SATerm Close*, 2 - SATerm Close* Sp+
+    U8 terminatorState = IsSATerm(previous) ? 1 : 0;
+
+    auto terminator = previous;
+
+    auto isLowerAhead = [&](U64 index) {
+        for (; index < size; ++index) {
+            auto property = SentenceBreakOf(symbols[index].CodePoint());
+
+            if (property == SentenceBreak::Lower) {
+                return true;
+            }
+
+            if (property == SentenceBreak::OLetter || property == SentenceBreak::Upper || IsParaSep(property) || IsSATerm(property)) {
+                return false;
+            }
+        }
+
+        return false;
+    };
+
+    for (auto index = position + 1; index < size; ++index) {
+        auto current = SentenceBreakOf(symbols[index].CodePoint());
+
+        Bool isBoundary;
+
+        if (rawPrevious == SentenceBreak::CR && current == SentenceBreak::LF) {
+            isBoundary = false;
+        } else if (IsParaSep(rawPrevious)) {
+            isBoundary = true;
+        } else if (IsSentenceBreakIgnorable(current)) {
+            rawPrevious = current;
+
+            continue;
+        } else if (previous == SentenceBreak::ATerm && current == SentenceBreak::Numeric) {
+            isBoundary = false;
+        } else if ((beforePrevious == SentenceBreak::Upper || beforePrevious == SentenceBreak::Lower)
+                && previous == SentenceBreak::ATerm
+                && current == SentenceBreak::Upper) {
+            isBoundary = false;
+        } else if (terminatorState != 0 && terminator == SentenceBreak::ATerm && isLowerAhead(index)) {
+            isBoundary = false;
+        } else if (terminatorState != 0 && (current == SentenceBreak::SContinue || IsSATerm(current))) {
+            isBoundary = false;
+        } else if (terminatorState == 1 && (current == SentenceBreak::Close || current == SentenceBreak::Sp || IsParaSep(current))) {
+            isBoundary = false;
+        } else if (terminatorState == 2 && (current == SentenceBreak::Sp || IsParaSep(current))) {
+            isBoundary = false;
+        } else {
+            isBoundary = terminatorState != 0;
+        }
+
+        if (isBoundary) {
+            return index;
+        }
+
+        if (IsSATerm(current)) {
+            terminatorState = 1;
+
+            terminator = current;
+        } else if (terminatorState == 1 && current == SentenceBreak::Close) {
+            terminatorState = 1;
+        } else if (terminatorState != 0 && current == SentenceBreak::Sp) {
+            terminatorState = 2;
+        } else {
+            terminatorState = 0;
+        }
+
+        beforePrevious = previous;
+
+        previous = current;
+
+        rawPrevious = current;
+    }
+
+    return size;
+}
+
+template<U64 (*NextBoundaryV)(UStringView, U64)>
+class SegmentIterator {
+public:
+
+    constexpr SegmentIterator()
+            : _position(0), _nextPosition(0) {}
+
+    constexpr SegmentIterator(UStringView string, ConstLRef<U64> position)
+            : _string(string), _position(position), _nextPosition(NextBoundaryV(string, position)) {}
+
+public:
+
+    /**
+     * Position of segment in string
+     * @return Position
+     */
+    inline constexpr U64 Position() const {
+        return _position;
+    }
+
+public:
+
+    inline constexpr UStringView operator*() const {
+        return UStringView(_string.Data() + _position, _nextPosition - _position);
+    }
+
+    inline constexpr LRef<SegmentIterator<NextBoundaryV>> operator++() {
+        _position = _nextPosition;
+
+        _nextPosition = NextBoundaryV(_string, _position);
+
+        return *this;
+    }
+
+    inline constexpr Bool operator==(ConstLRef<SegmentIterator<NextBoundaryV>> iterator) const {
+        return _position == iterator._position;
+    }
+
+    inline constexpr Bool operator!=(ConstLRef<SegmentIterator<NextBoundaryV>> iterator) const {
+        return !(*this == iterator);
+    }
+
+private:
+
+    UStringView _string;
+
+    U64 _position;
+
+    U64 _nextPosition;
+};
+
+template<U64 (*NextBoundaryV)(UStringView, U64)>
+class SegmentRange {
+public:
+
+    using Iterator = SegmentIterator<NextBoundaryV>;
+
+public:
+
+    constexpr SegmentRange(UStringView string)
+            : _string(string) {}
+
+public:
+
+    inline constexpr Iterator begin() const {
+        return Iterator(_string, 0);
+    }
+
+    inline constexpr Iterator end() const {
+        return Iterator(_string, _string.Size());
+    }
+
+private:
+
+    UStringView _string;
+};
+
+inline constexpr SegmentRange<NextGraphemeBoundary> GraphemeClusters(UStringView string) {
+    return SegmentRange<NextGraphemeBoundary>(string);
+}
+
+inline constexpr SegmentRange<NextWordBoundary> Words(UStringView string) {
+    return SegmentRange<NextWordBoundary>(string);
+}
+
+inline constexpr SegmentRange<NextSentenceBoundary> Sentences(UStringView string) {
+    return SegmentRange<NextSentenceBoundary>(string);
+}
+
+/**
+ * Counting extended grapheme clusters (user-perceived characters), e.g. for diagnostics columns
+ * @param string String
+ * @return Grapheme clusters count
+ */
+inline constexpr U64 GraphemeClustersCount(UStringView string) {
+    U64 count = 0;
+
+    for (U64 position = 0; position < string.Size(); position = NextGraphemeBoundary(string, position)) {
+        ++count;
+    }
+
+    return count;
+}
+
+#endif //GSCROSSPLATFORM_SEGMENTATION_H
@@ -0,0 +1,520 @@
+#ifndef GSCROSSPLATFORM_SERIALIZATION_H
+#define GSCROSSPLATFORM_SERIALIZATION_H
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include <GSCrossPlatform/Array.h>
+#include <GSCrossPlatform/Map.h>
+#include <GSCrossPlatform/UString.h>
+
+/**
+ * Binary serialization of containers and strings for reading in place
+ *
+ * Layout is little endian, every value is aligned to its alignment (at most 8 bytes):
+ *  - trivially copyable values (integers, floats, enums, USymbol) are stored as is, so they must not contain pointers
+ *  - UString, Vector and Array are stored as U64 count and elements, trivially copyable elements are stored contiguously,
+ *    other elements are stored after table of U64 offsets (relative to table) for random access
+ *  - Map is stored as vector of keys and vector of values
+ * Serialized buffer must be 8-byte aligned for reading (e.g. memory mapped file)
+ */
+
+template<typename T>
+inline constexpr Bool IsVectorType = false;
+
+template<typename ValueT>
+inline constexpr Bool IsVectorType<Vector<ValueT>> = true;
+
+template<typename T>
+inline constexpr Bool IsArrayType = false;
+
+template<typename ValueT, auto SizeV>
+inline constexpr Bool IsArrayType<Array<ValueT, SizeV>> = true;
+
+template<typename T>
+inline constexpr Bool IsMapType = false;
+
+template<typename KeyT, typename ValueT>
+inline constexpr Bool IsMapType<Map<KeyT, ValueT>> = true;
+
+/**
+ * Checking type is stored as is
+ */
+template<typename T>
+inline constexpr Bool IsTriviallySerializable = std::is_trivially_copyable_v<T> && !std::is_pointer_v<T> && alignof(T) <= 8;
+
+/**
+ * Serialized size of count prefix
+ */
+inline constexpr U64 SerializedSizeBytes = sizeof(U64);
+
+template<typename T>
+class SerializedVectorView;
+
+template<typename KeyT, typename ValueT>
+class SerializedMapView;
+
+/**
+ * View of contiguous trivially copyable elements in serialized buffer
+ */
+template<typename T>
+class SerializedArrayView {
+public:
+
+    using Iterator = ConstPtr<T>;
+
+    using ConstIterator = ConstPtr<T>;
+
+public:
+
+    constexpr SerializedArrayView()
+            : _data(nullptr), _size(0) {}
+
+    constexpr SerializedArrayView(ConstPtr<T> data, ConstLRef<U64> size)
+            : _data(data), _size(size) {}
+
+public:
+
+    inline constexpr ConstPtr<T> Data() const {
+        return _data;
+    }
+
+    inline constexpr U64 Size() const {
+        return _size;
+    }
+
+    inline constexpr Bool Empty() const {
+        return _size == 0;
+    }
+
+public:
+
+    inline constexpr ConstIterator begin() const {
+        return _data;
+    }
+
+    inline constexpr ConstIterator end() const {
+        return _data + _size;
+    }
+
+public:
+
+    inline constexpr ConstLRef<T> operator[](ConstLRef<U64> index) const {
+        if (index >= _size) {
+            throw std::runtime_error("SerializedArrayView::operator[](ConstLRef<U64>) const: Index out of range!");
+        }
+
+        return _data[index];
+    }
+
+private:
+
+    ConstPtr<T> _data;
+
+    U64 _size;
+};
+
+/**
+ * Getting view type of serialized type
+ */
+template<typename T>
+inline auto SerializedViewOf() {
+    if constexpr (std::is_same_v<T, UString>) {
+        return UStringView();
+    } else if constexpr (IsTriviallySerializable<T>) {
+        return T();
+    } else if constexpr (IsVectorType<T> || IsArrayType<T>) {
+        if constexpr (IsTriviallySerializable<typename T::ValueType>) {
+            return SerializedArrayView<typename T::ValueType>();
+        } else {
+            return SerializedVectorView<typename T::ValueType>();
+        }
+    } else if constexpr (IsMapType<T>) {
+        return SerializedMapView<typename T::KeyType, typename T::ValueType>();
+    } else {
+        static_assert(IsMapType<T>, "SerializedViewOf<T>(): Type isn't serializable!");
+    }
+}
+
+template<typename T>
+using SerializedView = decltype(SerializedViewOf<T>());
+
+/**
+ * Reading serialized value in place
+ * @tparam T Serialized type
+ * @param data Serialized buffer (8-byte aligned)
+ * @param size Bytes count of buffer
+ * @param position Position of value, moved after value
+ * @return View of value
+ */
+template<typename T>
+inline SerializedView<T> ReadSerialized(ConstPtr<U8> data, ConstLRef<U64> size, LRef<U64> position);
+
+/**
+ * View of serialized elements with offsets table
+ */
+template<typename T>
+class SerializedVectorView {
+public:
+
+    constexpr SerializedVectorView()
+            : _data(nullptr), _size(0), _tablePosition(0), _count(0) {}
+
+    constexpr SerializedVectorView(ConstPtr<U8> data, ConstLRef<U64> size, ConstLRef<U64> tablePosition, ConstLRef<U64> count)
+            : _data(data), _size(size), _tablePosition(tablePosition), _count(count) {}
+
+public:
+
+    inline U64 Size() const {
+        return _count;
+    }
+
+    inline Bool Empty() const {
+        return _count == 0;
+    }
+
+public:
+
+    inline SerializedView<T> operator[](ConstLRef<U64> index) const {
+        if (index >= _count) {
+            throw std::runtime_error("SerializedVectorView::operator[](ConstLRef<U64>) const: Index out of range!");
+        }
+
+        U64 offset;
+
+        std::memcpy(&offset, _data + _tablePosition + index * sizeof(U64), sizeof(U64));
+
+        auto position = _tablePosition + offset;
+
+        return ReadSerialized<T>(_data, _size, position);
+    }
+
+private:
+
+    ConstPtr<U8> _data;
+
+    U64 _size;
+
+    U64 _tablePosition;
+
+    U64 _count;
+};
+
+/**
+ * View of serialized map (linear search as in Map)
+ */
+template<typename KeyT, typename ValueT>
+class SerializedMapView {
+public:
+
+    constexpr SerializedMapView() = default;
+
+    constexpr SerializedMapView(SerializedView<Vector<KeyT>> keys, SerializedView<Vector<ValueT>> values)
+            : _keys(keys), _values(values) {}
+
+public:
+
+    /**
+     * Finding index of key
+     * @param key Key
+     * @return Index of key or Size() if key isn't found
+     */
+    template<typename KeyViewT>
+    inline U64 Find(ConstLRef<KeyViewT> key) const {
+        for (U64 index = 0; index < _keys.Size(); ++index) {
+            if (_keys[index] == key) {
+                return index;
+            }
+        }
+
+        return _keys.Size();
+    }
+
+public:
+
+    inline ConstLRef<SerializedView<Vector<KeyT>>> Keys() const {
+        return _keys;
+    }
+
+    inline ConstLRef<SerializedView<Vector<ValueT>>> Values() const {
+        return _values;
+    }
+
+    inline U64 Size() const {
+        return _keys.Size();
+    }
+
+private:
+
+    SerializedView<Vector<KeyT>> _keys;
+
+    SerializedView<Vector<ValueT>> _values;
+};
+
+/**
+ * Checking space for bytes in serialized buffer
+ */
+inline Void CheckSerializedSize(ConstLRef<U64> size, ConstLRef<U64> position, ConstLRef<U64> bytesCount) {
+    if (position > size || bytesCount > size - position) {
+        throw std::runtime_error("CheckSerializedSize(ConstLRef<U64>, ConstLRef<U64>, ConstLRef<U64>): Serialized data is truncated!");
+    }
+}
+
+template<typename T>
+inline SerializedView<T> ReadSerialized(ConstPtr<U8> data, ConstLRef<U64> size, LRef<U64> position) {
+    static_assert(std::endian::native == std::endian::little, "ReadSerialized<T>(ConstPtr<U8>, ConstLRef<U64>, LRef<U64>): Big endian hosts aren't supported!");
+
+    if constexpr (IsMapType<T>) {
+        auto keys = ReadSerialized<Vector<typename T::KeyType>>(data, size, position);
+
+        auto values = ReadSerialized<Vector<typename T::ValueType>>(data, size, position);
+
+        if (keys.Size() != values.Size()) {
+            throw std::runtime_error("ReadSerialized<T>(ConstPtr<U8>, ConstLRef<U64>, LRef<U64>): Map keys and values counts are different!");
+        }
+
+        return SerializedMapView<typename T::KeyType, typename T::ValueType>(keys, values);
+    } else if constexpr (IsTriviallySerializable<T>) {
+        position = (position + alignof(T) - 1) & ~(alignof(T) - 1);
+
+        CheckSerializedSize(size, position, sizeof(T));
+
+        T value;
+
+        std::memcpy(&value, data + position, sizeof(T));
+
+        position += sizeof(T);
+
+        return value;
+    } else {
+        using ViewType = SerializedView<T>;
+
+        auto count = ReadSerialized<U64>(data, size, position);
+
+        if constexpr (std::is_same_v<T, UString>) {
+            CheckSerializedSize(size, position, count > size / sizeof(USymbol) ? size + 1 : count * sizeof(USymbol));
+
+            auto symbols = ReinterpretCast<ConstPtr<USymbol>>(data + position);
+
+            position += count * sizeof(USymbol);
+
+            return UStringView(symbols, count);
+        } else if constexpr (IsTriviallySerializable<typename T::ValueType>) {
+            using ValueType = typename T::ValueType;
+
+            position = (position + alignof(ValueType) - 1) & ~(alignof(ValueType) - 1);
+
+            CheckSerializedSize(size, position, count > size / sizeof(ValueType) ? size + 1 : count * sizeof(ValueType));
+
+            auto values = ReinterpretCast<ConstPtr<ValueType>>(data + position);
+
+            position += count * sizeof(ValueType);
+
+            return ViewType(values, count);
+        } else {
+            CheckSerializedSize(size, position, count > size / sizeof(U64) ? size + 1 : count * sizeof(U64));
+
+            auto tablePosition = position;
+
+            // elements are stored after table, position is moved after last element
+            if (count == 0) {
+                return ViewType(data, size, tablePosition, 0);
+            }
+
+            U64 lastOffset;
+
+            std::memcpy(&lastOffset, data + tablePosition + (count - 1) * sizeof(U64), sizeof(U64));
+
+            CheckSerializedSize(size, tablePosition, lastOffset);
+
+            position = tablePosition + lastOffset;
+
+            ViewType view(data, size, tablePosition, count);
+
+            ReadSerialized<typename T::ValueType>(data, size, position);
+
+            return view;
+        }
+    }
+}
+
+/**
+ * Writer of serialized values into growing buffer
+ */
+class BinaryWriter {
+public:
+
+    BinaryWriter() = default;
+
+public:
+
+    /**
+     * Writing value
+     * @tparam T Type of value (trivially copyable type, UString, Vector, Array or Map)
+     * @param value Value
+     * @return Writer
+     */
+    template<typename T>
+    inline LRef<BinaryWriter> Write(ConstLRef<T> value) {
+        static_assert(std::endian::native == std::endian::little, "BinaryWriter::Write<T>(ConstLRef<T>): Big endian hosts aren't supported!");
+
+        if constexpr (std::is_same_v<T, UString>) {
+            WriteSequence(value.Data(), value.Size());
+        } else if constexpr (IsTriviallySerializable<T>) {
+            WriteBytes(&value, sizeof(T), alignof(T));
+        } else if constexpr (IsVectorType<T> || IsArrayType<T>) {
+            WriteSequence(value.Data(), value.Size());
+        } else if constexpr (IsMapType<T>) {
+            Vector<typename T::KeyType> keys;
+
+            Vector<typename T::ValueType> values;
+
+            keys.Reserve(value.Size());
+
+            values.Reserve(value.Size());
+
+            for (auto &pair : value) {
+                keys.Append(pair.Key());
+
+                values.Append(pair.Value());
+            }
+
+            Write(keys);
+
+            Write(values);
+        } else {
+            static_assert(IsMapType<T>, "BinaryWriter::Write<T>(ConstLRef<T>): Type isn't serializable!");
+        }
+
+        return *this;
+    }
+
+public:
+
+    inline ConstLRef<Vector<U8>> Bytes() const {
+        return _bytes;
+    }
+
+    /**
+     * Taking written bytes and clearing writer
+     * @return Bytes
+     */
+    inline Vector<U8> Take() {
+        return std::move(_bytes);
+    }
+
+private:
+
+    template<typename T>
+    inline Void WriteSequence(ConstPtr<T> values, ConstLRef<U64> count) {
+        Write<U64>(count);
+
+        if constexpr (IsTriviallySerializable<T>) {
+            // bulk copy of contiguous elements
+            WriteBytes(values, count * sizeof(T), alignof(T));
+        } else {
+            auto tablePosition = _bytes.Size();
+
+            Resize(tablePosition + count * sizeof(U64));
+
+            for (U64 index = 0; index < count; ++index) {
+                Align(alignof(U64));
+
+                auto offset = StaticCast<U64>(_bytes.Size() - tablePosition);
+
+                std::memcpy(_bytes.Data() + tablePosition + index * sizeof(U64), &offset, sizeof(U64));
+
+                Write(values[index]);
+            }
+        }
+    }
+
+    inline Void WriteBytes(ConstPtr<Void> bytes, ConstLRef<U64> size, ConstLRef<U64> alignment) {
+        Align(alignment);
+
+        auto position = _bytes.Size();
+
+        Resize(position + size);
+
+        if (size > 0) {
+            std::memcpy(_bytes.Data() + position, bytes, size);
+        }
+    }
+
+    inline Void Align(ConstLRef<U64> alignment) {
+        auto position = _bytes.Size();
+
+        auto alignedPosition = (position + alignment - 1) & ~(alignment - 1);
+
+        Resize(alignedPosition);
+
+        // padding is zeroed for reproducible output
+        for (; position < alignedPosition; ++position) {
+            _bytes.Data()[position] = 0;
+        }
+    }
+
+    inline Void Resize(ConstLRef<U64> size) {
+        if (size > _bytes.Capacity()) {
+            _bytes.Reserve(size * 2);
+        }
+
+        _bytes.Resize(size);
+    }
+
+private:
+
+    Vector<U8> _bytes;
+};
+
+/**
+ * Reader of serialized values in place
+ */
+class BinaryReader {
+public:
+
+    /**
+     * Constructor for reader
+     * @param data Serialized buffer (8-byte aligned, must outlive views)
+     * @param size Bytes count of buffer
+     */
+    BinaryReader(ConstPtr<U8> data, ConstLRef<U64> size)
+            : _data(data), _size(size), _position(0) {
+        if (ReinterpretCast<std::uintptr_t>(data) % 8 != 0) {
+            throw std::runtime_error("BinaryReader::BinaryReader(ConstPtr<U8>, ConstLRef<U64>): Serialized data must be 8-byte aligned!");
+        }
+    }
+
+public:
+
+    /**
+     * Reading next value
+     * @tparam T Serialized type
+     * @return View of value
+     */
+    template<typename T>
+    inline SerializedView<T> Read() {
+        return ReadSerialized<T>(_data, _size, _position);
+    }
+
+public:
+
+    inline U64 Position() const {
+        return _position;
+    }
+
+    inline Bool IsEnd() const {
+        return _position >= _size;
+    }
+
+private:
+
+    ConstPtr<U8> _data;
+
+    U64 _size;
+
+    U64 _position;
+};
+
+#endif //GSCROSSPLATFORM_SERIALIZATION_H
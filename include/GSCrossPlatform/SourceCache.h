@@ -0,0 +1,173 @@
+#ifndef GSCROSSPLATFORM_SOURCECACHE_H
+#define GSCROSSPLATFORM_SOURCECACHE_H
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <GSCrossPlatform/Checksum.h>
+#include <GSCrossPlatform/LineIndex.h>
+#include <GSCrossPlatform/UTF8View.h>
+
+/**
+ * Immutable content of source file shared between cache users
+ *
+ * Decoded text and line index are built on first request (thread-safe)
+ */
+class SourceBuffer {
+public:
+
+    SourceBuffer(Vector<U8> bytes, U32 checksum);
+
+    SourceBuffer(ConstLRef<SourceBuffer> buffer) = delete;
+
+public:
+
+    /**
+     * Getting decoded text (malformed sequences are replaced with U+FFFD)
+     * @return Text
+     */
+    ConstLRef<UString> Text() const;
+
+    /**
+     * Getting line index of decoded text
+     * @return Line index (offsets in symbols)
+     */
+    ConstLRef<LineIndex> Lines() const;
+
+    /**
+     * Getting validated UTF-8 view of content
+     * @return View
+     */
+    inline UTF8View View() const {
+        return UTF8View(_bytes.Data(), _bytes.Size());
+    }
+
+public:
+
+    inline ConstLRef<Vector<U8>> Bytes() const {
+        return _bytes;
+    }
+
+    inline U64 Size() const {
+        return _bytes.Size();
+    }
+
+    /**
+     * Getting CRC32C checksum of content
+     * @return Checksum
+     */
+    inline U32 Checksum() const {
+        return _checksum;
+    }
+
+public:
+
+    LRef<SourceBuffer> operator=(ConstLRef<SourceBuffer> buffer) = delete;
+
+private:
+
+    Vector<U8> _bytes;
+
+    U32 _checksum;
+
+    mutable std::once_flag _textFlag;
+
+    mutable UString _text;
+
+    mutable std::once_flag _linesFlag;
+
+    mutable LineIndex _lines;
+};
+
+/**
+ * Process-wide cache of source files
+ *
+ * Files are cached by path and revalidated by modification time and size on every Load.
+ * Files with equal content (by CRC32C checksum and bytes) share one buffer
+ */
+class SourceCache {
+public:
+
+    SourceCache() = default;
+
+    SourceCache(ConstLRef<SourceCache> cache) = delete;
+
+public:
+
+    /**
+     * Getting process-wide cache
+     * @return Cache
+     */
+    static LRef<SourceCache> Instance();
+
+public:
+
+    /**
+     * Loading file from cache or from disk
+     * @param path Path to file
+     * @return Shared buffer of file content
+     */
+    std::shared_ptr<Const<SourceBuffer>> Load(ConstLRef<std::string> path);
+
+    /**
+     * Removing file from cache
+     * @param path Path to file
+     */
+    Void Invalidate(ConstLRef<std::string> path);
+
+    Void Clear();
+
+    /**
+     * Getting count of cached paths
+     * @return Count of paths
+     */
+    U64 Size() const;
+
+public:
+
+    LRef<SourceCache> operator=(ConstLRef<SourceCache> cache) = delete;
+
+private:
+
+    class Entry {
+    public:
+
+        Entry(std::shared_ptr<Const<SourceBuffer>> buffer, I64 modificationTime, U64 size)
+                : _buffer(std::move(buffer)), _modificationTime(modificationTime), _size(size) {}
+
+    public:
+
+        inline ConstLRef<std::shared_ptr<Const<SourceBuffer>>> Buffer() const {
+            return _buffer;
+        }
+
+        inline Bool IsValid(I64 modificationTime, U64 size) const {
+            return _modificationTime == modificationTime && _size == size;
+        }
+
+    private:
+
+        std::shared_ptr<Const<SourceBuffer>> _buffer;
+
+        I64 _modificationTime;
+
+        U64 _size;
+    };
+
+private:
+
+    std::shared_ptr<Const<SourceBuffer>> Deduplicate(RRef<Vector<U8>> bytes, U32 checksum);
+
+private:
+
+    mutable std::mutex _mutex;
+
+    std::unordered_map<std::string, Entry> _entries;
+
+    std::unordered_map<U32, std::vector<std::weak_ptr<Const<SourceBuffer>>>> _buffers;
+};
+
+#endif //GSCROSSPLATFORM_SOURCECACHE_H
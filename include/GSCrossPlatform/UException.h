@@ -17,7 +17,7 @@ public:
 
 public:
 
-    ConstPtr<C> what() const override {
+    ConstPtr<C> what() const noexcept override {
         return _utf8String.c_str();
     }
 
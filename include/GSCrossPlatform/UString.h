@@ -1,7 +1,20 @@
 #ifndef GSCROSSPLATFORM_USTRING_H
 #define GSCROSSPLATFORM_USTRING_H
 
+#include <charconv>
+#include <cstring>
+
+#include <GSCrossPlatform/Array.h>
 #include <GSCrossPlatform/Encoding.h>
+#include <GSCrossPlatform/UnicodeTables.h>
+
+inline constexpr U32 ASCIIToUpper(ConstLRef<U32> codePoint) {
+    return codePoint - 'a' < 26 ? codePoint ^ 0x20 : codePoint;
+}
+
+inline constexpr U32 ASCIIToLower(ConstLRef<U32> codePoint) {
+    return codePoint - 'A' < 26 ? codePoint ^ 0x20 : codePoint;
+}
 
 class USymbol {
 public:
@@ -14,23 +27,58 @@ public:
 
 public:
 
-    constexpr USymbol(ConstLRef<USymbol> symbol)
-            : _codePoint(symbol._codePoint) {}
+    // trivially copyable for bulk transcoding into symbol buffers
+    constexpr USymbol(ConstLRef<USymbol> symbol) = default;
+
+    constexpr USymbol(RRef<USymbol> symbol) noexcept = default;
+
+public:
+
+    inline constexpr Bool IsAlpha() const {
+        return HasProperty(UnicodeAlphaFlag);
+    }
+
+    inline constexpr Bool IsDigit() const {
+        return HasProperty(UnicodeDigitFlag);
+    }
+
+    inline constexpr Bool IsWhitespace() const {
+        return HasProperty(UnicodeWhitespaceFlag);
+    }
+
+    inline constexpr Bool IsIDStart() const {
+        return HasProperty(UnicodeIDStartFlag);
+    }
 
-    constexpr USymbol(RRef<USymbol> symbol) noexcept
-            : _codePoint(symbol._codePoint) {}
+    inline constexpr Bool IsIDContinue() const {
+        return HasProperty(UnicodeIDContinueFlag);
+    }
 
 public:
 
-    Bool IsAlpha() const;
+    inline constexpr USymbol ToUpper() const {
+        if (_codePoint < 0x80) {
+            return USymbol(ASCIIToUpper(_codePoint));
+        }
 
-    Bool IsDigit() const;
+        return UnicodeToUpper();
+    }
 
-    Bool IsWhitespace() const;
+    inline constexpr USymbol ToLower() const {
+        if (_codePoint < 0x80) {
+            return USymbol(ASCIIToLower(_codePoint));
+        }
 
-    Bool IsIDStart() const;
+        return UnicodeToLower();
+    }
 
-    Bool IsIDContinue() const;
+    inline constexpr USymbol CaseFold() const {
+        if (_codePoint < 0x80) {
+            return USymbol(ASCIIToLower(_codePoint));
+        }
+
+        return UnicodeCaseFold();
+    }
 
 public:
 
@@ -52,6 +100,24 @@ public:
         return bytes;
     }
 
+    /**
+     * Encoding symbol to UTF-8 without allocation
+     * @param bytes Output bytes
+     * @return Bytes count
+     */
+    inline constexpr U8 AsUTF8(LRef<Array<U8, 4>> bytes) const noexcept {
+        return EncodeUTF8(_codePoint, bytes);
+    }
+
+    /**
+     * Encoding symbol to UTF-16 without allocation
+     * @param units Output code units in native byte order
+     * @return Code units count
+     */
+    inline constexpr U8 AsUTF16(LRef<Array<U16, 2>> units) const noexcept {
+        return EncodeUTF16(_codePoint, units);
+    }
+
 public:
 
     inline constexpr U32 CodePoint() const {
@@ -60,37 +126,133 @@ public:
 
 public:
 
-    inline constexpr LRef<USymbol> operator=(ConstLRef<USymbol> symbol) {
-        if (this == &symbol) {
-            return *this;
+    inline constexpr LRef<USymbol> operator=(ConstLRef<USymbol> symbol) = default;
+
+    inline constexpr LRef<USymbol> operator=(RRef<USymbol> symbol) noexcept = default;
+
+    inline constexpr Bool operator==(ConstLRef<USymbol> symbol) const {
+        return _codePoint == symbol._codePoint;
+    }
+
+    inline constexpr Bool operator!=(ConstLRef<USymbol> symbol) const {
+        return !(*this == symbol);
+    }
+
+private:
+
+    inline constexpr Bool HasProperty(ConstLRef<U32> flag) const {
+        return (UnicodePropertiesOf(_codePoint) & flag) != 0;
+    }
+
+    USymbol UnicodeToUpper() const;
+
+    USymbol UnicodeToLower() const;
+
+    USymbol UnicodeCaseFold() const;
+
+private:
+
+    U32 _codePoint;
+};
+
+class UString;
+
+class UStringView {
+public:
+
+    using Iterator = ConstPtr<USymbol>;
+
+    using ConstIterator = ConstPtr<USymbol>;
+
+public:
+
+    constexpr UStringView()
+            : _data(nullptr), _size(0) {}
+
+    constexpr UStringView(ConstPtr<USymbol> data, ConstLRef<U64> size)
+            : _data(data), _size(size) {}
+
+    constexpr UStringView(ConstLRef<UString> string);
+
+public:
+
+    inline constexpr UStringView Substring(ConstLRef<U64> offset, ConstLRef<U64> size) const {
+        if (offset > _size) {
+            throw std::runtime_error("UStringView::Substring(ConstLRef<U64>, ConstLRef<U64>) const: Offset out of range!");
         }
 
-        _codePoint = symbol._codePoint;
+        return UStringView(_data + offset, size < _size - offset ? size : _size - offset);
+    }
 
-        return *this;
+    inline constexpr UStringView Substring(ConstLRef<U64> offset) const {
+        return Substring(offset, _size);
     }
 
-    inline constexpr LRef<USymbol> operator=(RRef<USymbol> symbol) noexcept {
-        if (this == &symbol) {
-            return *this;
+public:
+
+    inline constexpr ConstPtr<USymbol> Data() const {
+        return _data;
+    }
+
+    inline constexpr U64 Size() const {
+        return _size;
+    }
+
+    inline constexpr Bool Empty() const {
+        return _size == 0;
+    }
+
+public:
+
+    inline constexpr ConstIterator begin() const {
+        return _data;
+    }
+
+    inline constexpr ConstIterator end() const {
+        return _data + _size;
+    }
+
+    inline constexpr ConstIterator cbegin() const {
+        return _data;
+    }
+
+    inline constexpr ConstIterator cend() const {
+        return _data + _size;
+    }
+
+public:
+
+    inline constexpr Bool operator==(ConstLRef<UStringView> view) const {
+        if (_size != view._size) {
+            return false;
         }
 
-        _codePoint = symbol._codePoint;
+        for (U64 index = 0; index < _size; ++index) {
+            if (_data[index] != view._data[index]) {
+                return false;
+            }
+        }
 
-        return *this;
+        return true;
     }
 
-    inline constexpr Bool operator==(ConstLRef<USymbol> symbol) const {
-        return _codePoint == symbol._codePoint;
+    inline constexpr Bool operator!=(ConstLRef<UStringView> view) const {
+        return !(*this == view);
     }
 
-    inline constexpr Bool operator!=(ConstLRef<USymbol> symbol) const {
-        return !(*this == symbol);
+    inline constexpr ConstLRef<USymbol> operator[](ConstLRef<U64> index) const {
+        if (index < _size) {
+            return _data[index];
+        }
+
+        throw std::runtime_error("UStringView::operator[](ConstLRef<U64>) const: Index out of range!");
     }
 
 private:
 
-    U32 _codePoint;
+    ConstPtr<USymbol> _data;
+
+    U64 _size;
 };
 
 class UString {
@@ -107,39 +269,60 @@ public:
     constexpr UString(Vector<USymbol> symbols)
             : _symbols(std::move(symbols)) {}
 
-    constexpr UString(ConstPtr<C> string) {
-        for (U64 index = 0; string[index] != 0; ++index) {
-            auto byte = StaticCast<U8>(string[index]);
-
-            auto symbolSize = UTF8Size(byte);
-
-            Vector<U8> bytes;
-
-            bytes.Append(byte);
-
-            for (U64 i = 1; i < symbolSize; ++i) {
-                ++index;
-
-                byte = StaticCast<U8>(string[index]);
-
-                bytes.Append(byte);
-            }
+    constexpr UString(ConstLRef<UStringView> view) {
+        _symbols.Append(view.Data(), view.Size());
+    }
 
-            auto codePoint = FromUTF8(bytes);
+    constexpr UString(ConstPtr<C> string)
+            : UString(string, std::char_traits<C>::length(string)) {}
+
+    /**
+     * Constructor for UTF-8 string
+     * @param string UTF-8 string
+     * @param size Bytes count
+     * @param mode Handling of malformed UTF-8
+     */
+    constexpr UString(ConstPtr<C> string, ConstLRef<U64> size, UTF8ErrorMode mode = UTF8ErrorMode::Replace) {
+        AppendUTF8(string, size, mode);
+    }
 
-            _symbols.Append(USymbol(codePoint));
-        }
+    /**
+     * Constructor for text in encoding, byte order mark of encoding is skipped
+     * @param string Bytes
+     * @param size Bytes count
+     * @param encoding Encoding (TextEncoding::Unknown for detecting encoding)
+     */
+    UString(ConstPtr<C> string, ConstLRef<U64> size, TextEncoding encoding) {
+        AppendText(ReinterpretCast<ConstPtr<U8>>(string), size, encoding);
     }
 
 #if defined(__cpp_lib_char8_t)
 
     constexpr UString(ConstPtr<C8> string)
-            : UString(ReinterpretCast<ConstPtr<C>>(string)) {}
+            : UString(string, std::char_traits<C8>::length(string)) {}
+
+    constexpr UString(ConstPtr<C8> string, ConstLRef<U64> size, UTF8ErrorMode mode = UTF8ErrorMode::Replace) {
+        AppendUTF8(string, size, mode);
+    }
 
 #endif
 
-    // TODO add supporting UTF-16 strings
-    constexpr UString(ConstPtr<C16> string);
+    constexpr UString(ConstPtr<C16> string)
+            : UString(string, std::char_traits<C16>::length(string)) {}
+
+    /**
+     * Constructor for UTF-16 string, unpaired surrogates are replaced with U+FFFD
+     * @param string UTF-16 string
+     * @param size Code units count
+     * @param byteOrder Byte order of code units
+     */
+    constexpr UString(ConstPtr<C16> string, ConstLRef<U64> size, std::endian byteOrder = std::endian::native) {
+        if (byteOrder == std::endian::little) {
+            AppendUTF16<std::endian::little>(string, size);
+        } else {
+            AppendUTF16<std::endian::big>(string, size);
+        }
+    }
 
     constexpr UString(ConstPtr<C32> string) {
         for (U64 index = 0; string[index] != 0; ++index) {
@@ -148,17 +331,17 @@ public:
     }
 
     constexpr UString(ConstLRef<std::string> string)
-            : UString(string.c_str()) {}
+            : UString(string.data(), string.size()) {}
 
 #if defined(__cpp_lib_char8_t)
 
     constexpr UString(ConstLRef<std::u8string> string)
-            : UString(string.c_str()) {}
+            : UString(string.data(), string.size()) {}
 
 #endif
 
     constexpr UString(ConstLRef<std::u16string> string)
-            : UString(string.c_str()) {}
+            : UString(string.data(), string.size()) {}
 
     constexpr UString(ConstLRef<std::u32string> string)
             : UString(string.c_str()) {}
@@ -179,38 +362,98 @@ public:
         return *this;
     }
 
+    inline constexpr LRef<UString> Append(ConstLRef<UStringView> view) {
+        _symbols.Append(view.Data(), view.Size());
+
+        return *this;
+    }
+
+    inline constexpr LRef<UString> Reserve(ConstLRef<U64> size) {
+        _symbols.Reserve(size);
+
+        return *this;
+    }
+
+    /**
+     * Resizing string, new symbols have unspecified values and must be assigned by caller
+     * @param size New size
+     * @return String
+     */
+    inline constexpr LRef<UString> Resize(ConstLRef<U64> size) {
+        _symbols.Resize(size);
+
+        return *this;
+    }
+
     inline constexpr Void Clear() {
         _symbols.Clear();
     }
 
 public:
 
+    inline constexpr Ptr<USymbol> Data() {
+        return _symbols.Data();
+    }
+
+    inline constexpr ConstPtr<USymbol> Data() const {
+        return _symbols.Data();
+    }
+
     inline constexpr U64 Size() const {
         return _symbols.Size();
     }
 
+    inline constexpr U64 Capacity() const {
+        return _symbols.Capacity();
+    }
+
     inline constexpr Bool Empty() const {
         return _symbols.Empty();
     }
 
 public:
 
+    /**
+     * Counting bytes of string in UTF-8 without encoding
+     * @return Bytes count
+     */
+    inline constexpr U64 UTF8Size() const {
+        return UTF32ToUTF8Length(_symbols.Data(), _symbols.Size());
+    }
+
+    /**
+     * Counting code units of string in UTF-16 without encoding
+     * @return Code units count
+     */
+    inline constexpr U64 UTF16Size() const {
+        return UTF32ToUTF16Length(_symbols.Data(), _symbols.Size());
+    }
+
     inline std::string AsUTF8() const {
         std::string string;
 
-        for (auto &symbol : _symbols) {
-            for (auto &byte : ToUTF8(symbol.CodePoint())) {
-                string += StaticCast<C>(byte);
-            }
-        }
+        string.resize(UTF8Size());
+
+        UTF32ToUTF8(_symbols.Data(), _symbols.Size(), string.data());
 
         return string;
     }
 
-    inline std::u16string AsUTF16() const {
+    /**
+     * Encoding string to UTF-16
+     * @param byteOrder Byte order of code units
+     * @return UTF-16 string
+     */
+    inline std::u16string AsUTF16(std::endian byteOrder = std::endian::native) const {
         std::u16string u16string;
 
-        // ...
+        u16string.resize(UTF16Size());
+
+        if (byteOrder == std::endian::little) {
+            UTF32ToUTF16<std::endian::little>(_symbols.Data(), _symbols.Size(), u16string.data());
+        } else {
+            UTF32ToUTF16<std::endian::big>(_symbols.Data(), _symbols.Size(), u16string.data());
+        }
 
         return u16string;
     }
@@ -225,6 +468,55 @@ public:
         return u32string;
     }
 
+    /**
+     * Encoding string to bytes in encoding without byte order mark
+     * @param encoding Encoding
+     * @return Bytes
+     */
+    inline std::string AsEncoding(TextEncoding encoding) const {
+        std::string bytes;
+
+        switch (encoding) {
+            case TextEncoding::UTF8:
+                return AsUTF8();
+            case TextEncoding::UTF16LE:
+            case TextEncoding::UTF16BE: {
+                auto u16string = AsUTF16(encoding == TextEncoding::UTF16LE ? std::endian::little : std::endian::big);
+
+                bytes.resize(u16string.size() * 2);
+
+                std::memcpy(bytes.data(), u16string.data(), bytes.size());
+
+                break;
+            }
+            case TextEncoding::UTF32LE:
+            case TextEncoding::UTF32BE:
+                bytes.reserve(_symbols.Size() * 4);
+
+                for (auto &symbol : _symbols) {
+                    auto codePoint = symbol.CodePoint();
+
+                    for (U64 index = 0; index < 4; ++index) {
+                        auto shift = encoding == TextEncoding::UTF32LE ? index * 8 : 24 - index * 8;
+
+                        bytes += StaticCast<C>((codePoint >> shift) & 0xFF);
+                    }
+                }
+
+                break;
+            case TextEncoding::Unknown:
+                throw std::runtime_error("UString::AsEncoding(TextEncoding): Unknown encoding!");
+            default:
+                bytes.resize(_symbols.Size());
+
+                UTF32ToLegacy(_symbols.Data(), _symbols.Size(), encoding, bytes.data());
+
+                break;
+        }
+
+        return bytes;
+    }
+
 public:
 
     inline constexpr Iterator begin() {
@@ -280,16 +572,26 @@ public:
     }
 
     inline constexpr LRef<UString> operator+=(ConstLRef<UString> string) {
-        for (auto &symbol : string) {
-            _symbols.Append(symbol);
+        if (this == &string) {
+            auto stringCopy = string;
+
+            return *this += stringCopy;
         }
 
+        _symbols.Append(string._symbols.Data(), string.Size());
+
         return *this;
     }
 
+    inline constexpr LRef<UString> operator+=(ConstLRef<UStringView> view) {
+        return Append(view);
+    }
+
     inline constexpr UString operator+(ConstLRef<USymbol> symbol) const {
         UString outputString;
 
+        outputString.Reserve(Size() + 1);
+
         outputString += *this;
 
         outputString += symbol;
@@ -300,6 +602,8 @@ public:
     inline constexpr UString operator+(ConstLRef<UString> string) const {
         UString outputString;
 
+        outputString.Reserve(Size() + string.Size());
+
         outputString += *this;
 
         outputString += string;
@@ -307,6 +611,18 @@ public:
         return outputString;
     }
 
+    inline constexpr UString operator+(ConstLRef<UStringView> view) const {
+        UString outputString;
+
+        outputString.Reserve(Size() + view.Size());
+
+        outputString += *this;
+
+        outputString += view;
+
+        return outputString;
+    }
+
     inline constexpr Bool operator==(ConstLRef<UString> string) const {
         if (Size() != string.Size()) {
             return false;
@@ -325,6 +641,14 @@ public:
         return !(*this == string);
     }
 
+    inline constexpr Bool operator==(ConstLRef<UStringView> view) const {
+        return UStringView(*this) == view;
+    }
+
+    inline constexpr Bool operator!=(ConstLRef<UStringView> view) const {
+        return !(*this == view);
+    }
+
     inline constexpr auto operator<=>(ConstLRef<UString> string) const {
         return Size() <=> string.Size();
     }
@@ -337,38 +661,542 @@ public:
         return _symbols[index];
     }
 
+private:
+
+    template<typename ByteT>
+    inline constexpr Void AppendUTF8(ConstPtr<ByteT> string, ConstLRef<U64> size, UTF8ErrorMode mode) {
+        if (mode == UTF8ErrorMode::Strict) {
+            auto errorPosition = FindUTF8Error(string, size);
+
+            if (errorPosition != size) {
+                throw std::runtime_error("UString::AppendUTF8(ConstPtr<ByteT>, ConstLRef<U64>, UTF8ErrorMode): Invalid UTF-8 at byte "
+                                         + std::to_string(errorPosition) + "!");
+            }
+        }
+
+        auto oldSize = _symbols.Size();
+
+        _symbols.Resize(oldSize + UTF8ToUTF32Length(string, size));
+
+        UTF8ToUTF32(string, size, _symbols.Data() + oldSize);
+    }
+
+    inline Void AppendText(ConstPtr<U8> bytes, U64 size, TextEncoding encoding) {
+        if (encoding == TextEncoding::Unknown) {
+            encoding = DetectTextEncoding(bytes, size);
+        }
+
+        U64 bomSize;
+
+        if (DetectBOM(bytes, size, bomSize) == encoding) {
+            bytes += bomSize;
+
+            size -= bomSize;
+        }
+
+        switch (encoding) {
+            case TextEncoding::UTF8:
+                AppendUTF8(bytes, size, UTF8ErrorMode::Replace);
+
+                break;
+            case TextEncoding::UTF16LE:
+            case TextEncoding::UTF16BE: {
+                // copying for alignment of code units
+                std::u16string units(size / 2, 0);
+
+                std::memcpy(units.data(), bytes, units.size() * 2);
+
+                if (encoding == TextEncoding::UTF16LE) {
+                    AppendUTF16<std::endian::little>(units.data(), units.size());
+                } else {
+                    AppendUTF16<std::endian::big>(units.data(), units.size());
+                }
+
+                if (size % 2 != 0) {
+                    _symbols.Append(USymbol(ReplacementCodePoint));
+                }
+
+                break;
+            }
+            case TextEncoding::UTF32LE:
+            case TextEncoding::UTF32BE:
+                _symbols.Reserve(_symbols.Size() + size / 4 + 1);
+
+                for (U64 index = 0; index + 4 <= size; index += 4) {
+                    U32 codePoint = 0;
+
+                    for (U64 byteIndex = 0; byteIndex < 4; ++byteIndex) {
+                        auto shift = encoding == TextEncoding::UTF32LE ? byteIndex * 8 : 24 - byteIndex * 8;
+
+                        codePoint |= StaticCast<U32>(bytes[index + byteIndex]) << shift;
+                    }
+
+                    _symbols.Append(USymbol(codePoint - 0xD800 < 0x800 || codePoint > 0x10FFFF ? ReplacementCodePoint : codePoint));
+                }
+
+                if (size % 4 != 0) {
+                    _symbols.Append(USymbol(ReplacementCodePoint));
+                }
+
+                break;
+            default: {
+                auto oldSize = _symbols.Size();
+
+                _symbols.Resize(oldSize + size);
+
+                LegacyToUTF32(bytes, size, encoding, _symbols.Data() + oldSize);
+
+                break;
+            }
+        }
+    }
+
+    template<std::endian ByteOrderV>
+    inline constexpr Void AppendUTF16(ConstPtr<C16> string, ConstLRef<U64> size) {
+        auto oldSize = _symbols.Size();
+
+        _symbols.Resize(oldSize + UTF16ToUTF32Length<ByteOrderV>(string, size));
+
+        UTF16ToUTF32<ByteOrderV>(string, size, _symbols.Data() + oldSize);
+    }
+
 private:
 
     Vector<USymbol> _symbols;
 };
 
-inline constexpr UString operator""_us(ConstPtr<C> string, U64 size) {
-    return UString(string);
+constexpr UStringView::UStringView(ConstLRef<UString> string)
+        : _data(string.Data()), _size(string.Size()) {}
+
+enum class CaseMapping : U8 {
+    Upper,
+    Lower,
+    Fold
+};
+
+/**
+ * Appending full Unicode case mapping of string (may change string length, e.g. 'ß' -> 'SS')
+ * @param string String
+ * @param mapping Case mapping
+ * @param outputString Output string
+ */
+Void AppendUnicodeCaseMapped(UStringView string, CaseMapping mapping, LRef<UString> outputString);
+
+/**
+ * Finding end of ASCII run, checking symbols in blocks for vectorization
+ * @param symbols Symbols
+ * @param size Size
+ * @return Index of first non ASCII symbol or size
+ */
+inline constexpr U64 FindNonASCII(ConstPtr<USymbol> symbols, ConstLRef<U64> size) {
+    U64 index = 0;
+
+    for (; index + 16 <= size; index += 16) {
+        U32 codePointsMask = 0;
+
+        for (U64 i = 0; i < 16; ++i) {
+            codePointsMask |= symbols[index + i].CodePoint();
+        }
+
+        if (codePointsMask >= 0x80) {
+            break;
+        }
+    }
+
+    for (; index < size && symbols[index].CodePoint() < 0x80; ++index);
+
+    return index;
 }
 
-#if defined(__cpp_lib_char8_t)
+inline constexpr U64 FindASCII(ConstPtr<USymbol> symbols, ConstLRef<U64> size) {
+    U64 index = 0;
+
+    for (; index < size && symbols[index].CodePoint() >= 0x80; ++index);
 
-inline constexpr UString operator""_us(ConstPtr<C8> string, U64 size) {
-    return UString(string);
+    return index;
 }
 
-#endif
+/**
+ * Checking symbols for lowercase mapping depending on context (only Final_Sigma for root locale, case folding has no context)
+ * @param symbols Symbols
+ * @param size Size
+ * @return Is any symbol capital sigma
+ */
+inline constexpr Bool HasContextSensitiveCase(ConstPtr<USymbol> symbols, ConstLRef<U64> size) {
+    for (U64 index = 0; index < size; ++index) {
+        if (symbols[index].CodePoint() == 0x03A3) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline UString MapCase(UStringView string, CaseMapping mapping) {
+    UString outputString;
+
+    outputString.Reserve(string.Size());
+
+    auto symbols = string.Data();
+
+    auto size = string.Size();
+
+    for (U64 index = 0; index < size;) {
+        auto asciiSize = FindNonASCII(symbols + index, size - index);
+
+        auto offset = outputString.Size();
+
+        outputString.Append(UStringView(symbols + index, asciiSize));
+
+        auto outputSymbols = outputString.Data() + offset;
+
+        if (mapping == CaseMapping::Upper) {
+            for (U64 i = 0; i < asciiSize; ++i) {
+                outputSymbols[i] = USymbol(ASCIIToUpper(outputSymbols[i].CodePoint()));
+            }
+        } else {
+            for (U64 i = 0; i < asciiSize; ++i) {
+                outputSymbols[i] = USymbol(ASCIIToLower(outputSymbols[i].CodePoint()));
+            }
+        }
+
+        index += asciiSize;
+
+        auto unicodeSize = FindASCII(symbols + index, size - index);
+
+        if (unicodeSize > 0) {
+            // lowercase of capital sigma depends on surrounding letters (final sigma), so whole string is mapped with context
+            if (mapping == CaseMapping::Lower && HasContextSensitiveCase(symbols + index, unicodeSize)) {
+                outputString.Clear();
+
+                AppendUnicodeCaseMapped(string, mapping, outputString);
+
+                return outputString;
+            }
+
+            AppendUnicodeCaseMapped(UStringView(symbols + index, unicodeSize), mapping, outputString);
+
+            index += unicodeSize;
+        }
+    }
+
+    return outputString;
+}
+
+inline UString ToUpper(UStringView string) {
+    return MapCase(string, CaseMapping::Upper);
+}
+
+inline UString ToLower(UStringView string) {
+    return MapCase(string, CaseMapping::Lower);
+}
+
+inline UString CaseFold(UStringView string) {
+    return MapCase(string, CaseMapping::Fold);
+}
+
+inline Bool EqualsIgnoreCase(UStringView firstString, UStringView secondString) {
+    auto firstSymbols = firstString.Data();
+
+    auto secondSymbols = secondString.Data();
+
+    auto size = firstString.Size() < secondString.Size() ? firstString.Size() : secondString.Size();
+
+    U64 index = 0;
+
+    for (; index < size; ++index) {
+        auto firstCodePoint = firstSymbols[index].CodePoint();
+
+        auto secondCodePoint = secondSymbols[index].CodePoint();
+
+        if ((firstCodePoint | secondCodePoint) >= 0x80) {
+            break;
+        }
+
+        if (ASCIIToLower(firstCodePoint) != ASCIIToLower(secondCodePoint)) {
+            return false;
+        }
+    }
+
+    if (index == firstString.Size() && index == secondString.Size()) {
+        return true;
+    }
+
+    if (index == size) {
+        return false;
+    }
+
+    return CaseFold(firstString.Substring(index)) == CaseFold(secondString.Substring(index));
+}
+
+inline constexpr U64 HashAppend(U64 hash, ConstLRef<U32> codePoint) {
+    hash ^= codePoint;
+
+    hash *= 0x100000001B3;
+
+    return hash;
+}
+
+inline constexpr U64 HashInitial = 0xCBF29CE484222325;
+
+inline constexpr U64 Hash(UStringView string) {
+    auto hash = HashInitial;
 
-inline constexpr UString operator""_us(ConstPtr<C16> string, U64 size) {
-    return UString(string);
+    for (auto &symbol : string) {
+        hash = HashAppend(hash, symbol.CodePoint());
+    }
+
+    return hash;
+}
+
+/**
+ * Hashing string case-insensitively, equal to Hash(CaseFold(string))
+ * @param string String
+ * @return Hash
+ */
+inline U64 HashIgnoreCase(UStringView string) {
+    auto hash = HashInitial;
+
+    auto symbols = string.Data();
+
+    auto size = string.Size();
+
+    for (U64 index = 0; index < size;) {
+        auto asciiSize = FindNonASCII(symbols + index, size - index);
+
+        for (U64 i = 0; i < asciiSize; ++i) {
+            hash = HashAppend(hash, ASCIIToLower(symbols[index + i].CodePoint()));
+        }
+
+        index += asciiSize;
+
+        auto unicodeSize = FindASCII(symbols + index, size - index);
+
+        if (unicodeSize > 0) {
+            UString foldedString;
+
+            AppendUnicodeCaseMapped(UStringView(symbols + index, unicodeSize), CaseMapping::Fold, foldedString);
+
+            for (auto &symbol : foldedString) {
+                hash = HashAppend(hash, symbol.CodePoint());
+            }
+
+            index += unicodeSize;
+        }
+    }
+
+    return hash;
 }
 
-inline constexpr UString operator""_us(ConstPtr<C32> string, U64 size) {
-    return UString(string);
+inline constexpr UString operator+(ConstLRef<UStringView> view, ConstLRef<UString> string) {
+    UString outputString;
+
+    outputString.Reserve(view.Size() + string.Size());
+
+    outputString += view;
+
+    outputString += string;
+
+    return outputString;
+}
+
+/**
+ * String literal as template parameter of _us literal operator, decoded to symbols at compile time
+ */
+template<typename CharT, U64 SizeV>
+class UStringLiteral {
+public:
+
+    consteval UStringLiteral(Const<CharT> (&string)[SizeV]) {
+        for (U64 index = 0; index < SizeV; ++index) {
+            _string[index] = string[index];
+        }
+    }
+
+public:
+
+    /**
+     * Decoding literal
+     * @param symbols Symbols for writing or nullptr for counting only
+     * @return Symbols count
+     */
+    consteval U64 Decode(Ptr<USymbol> symbols) const {
+        U64 symbolsCount = 0;
+
+        // last element is null terminator
+        for (U64 index = 0; index + 1 < SizeV;) {
+            U32 codePoint = InvalidCodePoint;
+
+            if constexpr (sizeof(CharT) == 1) {
+                U8 bytes[4] = {};
+
+                for (U64 i = 0; i < 4 && index + i + 1 < SizeV; ++i) {
+                    bytes[i] = StaticCast<U8>(_string[index + i]);
+                }
+
+                index += FromUTF8(bytes, SizeV - 1 - index < 4 ? SizeV - 1 - index : 4, codePoint);
+            } else if constexpr (sizeof(CharT) == 2) {
+                U32 unit = StaticCast<U16>(_string[index]);
+
+                ++index;
+
+                if (unit >= 0xD800 && unit <= 0xDBFF && index + 1 < SizeV) {
+                    U32 lowUnit = StaticCast<U16>(_string[index]);
+
+                    if (lowUnit >= 0xDC00 && lowUnit <= 0xDFFF) {
+                        unit = 0x10000 + ((unit - 0xD800) << 10) + (lowUnit - 0xDC00);
+
+                        ++index;
+                    }
+                }
+
+                codePoint = unit >= 0xD800 && unit <= 0xDFFF ? InvalidCodePoint : unit;
+            } else {
+                U32 unit = StaticCast<U32>(_string[index]);
+
+                ++index;
+
+                codePoint = unit > 0x10FFFF || (unit >= 0xD800 && unit <= 0xDFFF) ? InvalidCodePoint : unit;
+            }
+
+            if (codePoint == InvalidCodePoint) {
+                throw std::runtime_error("UStringLiteral::Decode(Ptr<USymbol>): Invalid encoded string literal!");
+            }
+
+            if (symbols != nullptr) {
+                symbols[symbolsCount] = USymbol(codePoint);
+            }
+
+            ++symbolsCount;
+        }
+
+        return symbolsCount;
+    }
+
+public:
+
+    // public for using as structural template parameter type
+
+    CharT _string[SizeV];
+};
+
+/**
+ * Static read-only storage of decoded _us literal
+ */
+template<UStringLiteral StringV>
+inline constexpr auto UStringLiteralSymbols = []() consteval {
+    constexpr auto symbolsCount = StringV.Decode(nullptr);
+
+    Array<USymbol, (symbolsCount > 0 ? symbolsCount : 1)> symbols;
+
+    StringV.Decode(symbols.Data());
+
+    return symbols;
+}();
+
+/**
+ * String literal decoded at compile time, usable as constexpr view and convertible to UString
+ * @tparam StringV String literal
+ * @return View of static storage
+ */
+template<UStringLiteral StringV>
+inline consteval UStringView operator""_us() {
+    return UStringView(UStringLiteralSymbols<StringV>.Data(), StringV.Decode(nullptr));
 }
 
+enum class TextAlignment : U8 {
+    Left,
+    Right,
+    Center
+};
+
 class UStringStream {
 public:
 
-    constexpr UStringStream() = default;
+    constexpr UStringStream()
+            : _width(0), _fill(' '), _alignment(TextAlignment::Right), _base(10), _uppercase(false) {}
 
     constexpr UStringStream(ConstLRef<UString> string)
-            : _string(string) {}
+            : _string(string), _width(0), _fill(' '), _alignment(TextAlignment::Right), _base(10), _uppercase(false) {}
+
+    constexpr UStringStream(RRef<UString> string)
+            : _string(std::move(string)), _width(0), _fill(' '), _alignment(TextAlignment::Right), _base(10), _uppercase(false) {}
+
+public:
+
+    inline constexpr LRef<UStringStream> Reserve(ConstLRef<U64> size) {
+        _string.Reserve(size);
+
+        return *this;
+    }
+
+    inline constexpr LRef<UStringStream> SetWidth(ConstLRef<U64> width) {
+        _width = width;
+
+        return *this;
+    }
+
+    inline constexpr LRef<UStringStream> SetFill(ConstLRef<USymbol> fill) {
+        _fill = fill;
+
+        return *this;
+    }
+
+    inline constexpr LRef<UStringStream> SetAlignment(TextAlignment alignment) {
+        _alignment = alignment;
+
+        return *this;
+    }
+
+    inline constexpr LRef<UStringStream> SetBase(ConstLRef<I32> base) {
+        if (base < 2 || base > 36) {
+            throw std::runtime_error("UStringStream::SetBase(ConstLRef<I32>): Base out of range!");
+        }
+
+        _base = base;
+
+        return *this;
+    }
+
+    inline constexpr LRef<UStringStream> SetUppercase(ConstLRef<Bool> uppercase) {
+        _uppercase = uppercase;
+
+        return *this;
+    }
+
+    inline constexpr LRef<UStringStream> Hex() {
+        return SetBase(16);
+    }
+
+    inline constexpr LRef<UStringStream> Dec() {
+        return SetBase(10);
+    }
+
+public:
+
+    inline constexpr U64 Size() const {
+        return _string.Size();
+    }
+
+    inline constexpr U64 Width() const {
+        return _width;
+    }
+
+    inline constexpr USymbol Fill() const {
+        return _fill;
+    }
+
+    inline constexpr TextAlignment Alignment() const {
+        return _alignment;
+    }
+
+    inline constexpr I32 Base() const {
+        return _base;
+    }
+
+    inline constexpr Bool Uppercase() const {
+        return _uppercase;
+    }
 
 public:
 
@@ -376,30 +1204,162 @@ public:
         return _string;
     }
 
+    inline constexpr UString Take() {
+        return std::move(_string);
+    }
+
 public:
 
+    inline constexpr LRef<UStringStream> operator<<(ConstLRef<USymbol> symbol) {
+        auto trailingPadding = AppendPadding(1);
+
+        _string.Append(symbol);
+
+        AppendFill(trailingPadding);
+
+        return *this;
+    }
+
+    inline constexpr LRef<UStringStream> operator<<(ConstLRef<C> symbol) {
+        return *this << USymbol(StaticCast<U32>(StaticCast<U8>(symbol)));
+    }
+
+    inline constexpr LRef<UStringStream> operator<<(ConstLRef<C32> symbol) {
+        return *this << USymbol(StaticCast<U32>(symbol));
+    }
+
     inline constexpr LRef<UStringStream> operator<<(ConstLRef<UString> string) {
+        auto trailingPadding = AppendPadding(string.Size());
+
         _string += string;
 
+        AppendFill(trailingPadding);
+
+        return *this;
+    }
+
+    inline constexpr LRef<UStringStream> operator<<(ConstLRef<UStringView> view) {
+        auto trailingPadding = AppendPadding(view.Size());
+
+        _string += view;
+
+        AppendFill(trailingPadding);
+
+        return *this;
+    }
+
+    inline LRef<UStringStream> operator<<(ConstLRef<std::string> string) {
+        AppendUTF8(ReinterpretCast<ConstPtr<U8>>(string.data()), string.size());
+
         return *this;
     }
 
-    inline constexpr LRef<UStringStream> operator<<(ConstLRef<std::string> string) {
-        *this << UString(string);
+    inline LRef<UStringStream> operator<<(ConstPtr<C> string) {
+        AppendUTF8(ReinterpretCast<ConstPtr<U8>>(string), std::char_traits<C>::length(string));
 
         return *this;
     }
 
     template<typename T, std::enable_if_t<std::is_integral_v<T>, T> = 0>
-    inline constexpr LRef<UStringStream> operator<<(ConstLRef<T> value) {
-        *this << std::to_string(value);
+    inline LRef<UStringStream> operator<<(ConstLRef<T> value) {
+        C buffer[sizeof(T) * 8 + 1];
+
+        std::to_chars_result result;
+
+        if constexpr (std::is_same_v<T, Bool>) {
+            result = std::to_chars(buffer, buffer + sizeof(buffer), StaticCast<U8>(value), _base);
+        } else {
+            result = std::to_chars(buffer, buffer + sizeof(buffer), value, _base);
+        }
+
+        AppendASCII(buffer, result.ptr);
 
         return *this;
     }
 
+    template<typename T, std::enable_if_t<std::is_floating_point_v<T>, I32> = 0>
+    inline LRef<UStringStream> operator<<(ConstLRef<T> value) {
+        C buffer[128];
+
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+        AppendASCII(buffer, result.ptr);
+
+        return *this;
+    }
+
+private:
+
+    /**
+     * Appending padding before value and resetting width
+     * @param size Value size
+     * @return Padding size for appending after value
+     */
+    inline constexpr U64 AppendPadding(ConstLRef<U64> size) {
+        auto padding = size < _width ? _width - size : 0;
+
+        _width = 0;
+
+        auto leadingPadding = _alignment == TextAlignment::Right
+                              ? padding
+                              : _alignment == TextAlignment::Center ? padding / 2 : 0;
+
+        AppendFill(leadingPadding);
+
+        return padding - leadingPadding;
+    }
+
+    inline constexpr Void AppendFill(ConstLRef<U64> size) {
+        for (U64 index = 0; index < size; ++index) {
+            _string.Append(_fill);
+        }
+    }
+
+    inline constexpr Void AppendASCII(ConstPtr<C> begin, ConstPtr<C> end) {
+        auto trailingPadding = AppendPadding(StaticCast<U64>(end - begin));
+
+        for (auto iterator = begin; iterator != end; ++iterator) {
+            auto codePoint = StaticCast<U32>(*iterator);
+
+            _string.Append(USymbol(_uppercase ? ASCIIToUpper(codePoint) : codePoint));
+        }
+
+        AppendFill(trailingPadding);
+    }
+
+    inline constexpr Void AppendUTF8(ConstPtr<U8> bytes, ConstLRef<U64> size) {
+        U64 symbolsCount = 0;
+
+        for (U64 index = 0; index < size; ++index) {
+            symbolsCount += (bytes[index] & 0xC0) != 0x80;
+        }
+
+        auto trailingPadding = AppendPadding(symbolsCount);
+
+        for (U64 index = 0; index < size;) {
+            U32 codePoint;
+
+            index += FromUTF8(bytes + index, size - index, codePoint);
+
+            _string.Append(USymbol(codePoint == InvalidCodePoint ? ReplacementCodePoint : codePoint));
+        }
+
+        AppendFill(trailingPadding);
+    }
+
 private:
 
     UString _string;
+
+    U64 _width;
+
+    USymbol _fill;
+
+    TextAlignment _alignment;
+
+    I32 _base;
+
+    Bool _uppercase;
 };
 
 #endif //GSCROSSPLATFORM_USTRING_H
@@ -0,0 +1,262 @@
+#ifndef GSCROSSPLATFORM_UTF8CODEC_H
+#define GSCROSSPLATFORM_UTF8CODEC_H
+
+#include <GSCrossPlatform/Encoding.h>
+
+/**
+ * Incremental UTF-8 decoder for chunked input
+ *
+ * Sequences split between chunks are kept until next chunk, bytes between chunk boundaries are decoded with bulk UTF8ToUTF32.
+ * Malformed sequences are replaced with U+FFFD, so output is the same as decoding whole input at once
+ */
+class UTF8Decoder {
+public:
+
+    constexpr UTF8Decoder()
+            : _pending(), _pendingSize(0) {}
+
+public:
+
+    /**
+     * Decoding chunk of bytes
+     * @param bytes Bytes
+     * @param size Bytes count
+     * @param output Output code points (at least MaxOutputSize(size) code points)
+     * @return Code points count
+     */
+    template<typename ByteT, typename CodePointT>
+    inline constexpr U64 Decode(ConstPtr<ByteT> bytes, ConstLRef<U64> size, Ptr<CodePointT> output) {
+        U64 position = 0, count = 0;
+
+        // completing sequence from previous chunk
+        while (_pendingSize > 0 && position < size) {
+            U8 sequence[4];
+
+            U64 sequenceSize = 0;
+
+            for (; sequenceSize < _pendingSize; ++sequenceSize) {
+                sequence[sequenceSize] = _pending[sequenceSize];
+            }
+
+            for (auto index = position; sequenceSize < 4 && index < size; ++index, ++sequenceSize) {
+                sequence[sequenceSize] = StaticCast<U8>(bytes[index]);
+            }
+
+            if (IsTruncatedUTF8(sequence, sequenceSize)) {
+                for (; position < size; ++position) {
+                    _pending[_pendingSize++] = StaticCast<U8>(bytes[position]);
+                }
+
+                return count;
+            }
+
+            U32 codePoint;
+
+            auto symbolSize = FromUTF8(StaticCast<ConstPtr<U8>>(sequence), sequenceSize, codePoint);
+
+            output[count++] = StaticCast<CodePointT>(codePoint == InvalidCodePoint ? ReplacementCodePoint : codePoint);
+
+            // pending bytes are always prefix of valid sequence, so they are part of decoded symbol
+            position += symbolSize - _pendingSize;
+
+            _pendingSize = 0;
+        }
+
+        auto end = size;
+
+        for (U64 index = 1; index <= 3 && index <= size - position; ++index) {
+            auto byte = StaticCast<U8>(bytes[size - index]);
+
+            if ((byte & 0xC0) != 0x80) {
+                if (byte >= 0xC0 && IsTruncatedUTF8(bytes + size - index, index)) {
+                    end = size - index;
+                }
+
+                break;
+            }
+        }
+
+        count += UTF8ToUTF32(bytes + position, end - position, output + count);
+
+        for (; end < size; ++end) {
+            _pending[_pendingSize++] = StaticCast<U8>(bytes[end]);
+        }
+
+        return count;
+    }
+
+    /**
+     * Finishing input, incomplete sequence at end of input is replaced with U+FFFD
+     * @param output Output code points (at least 1 code point)
+     * @return Code points count
+     */
+    template<typename CodePointT>
+    inline constexpr U64 Finish(Ptr<CodePointT> output) {
+        if (_pendingSize == 0) {
+            return 0;
+        }
+
+        _pendingSize = 0;
+
+        output[0] = StaticCast<CodePointT>(ReplacementCodePoint);
+
+        return 1;
+    }
+
+    inline constexpr Void Reset() {
+        _pendingSize = 0;
+    }
+
+public:
+
+    /**
+     * Maximum code points count of Decode for chunk
+     * @param size Bytes count of chunk
+     * @return Code points count
+     */
+    inline constexpr U64 MaxOutputSize(ConstLRef<U64> size) const {
+        return size + _pendingSize;
+    }
+
+    inline constexpr U64 PendingSize() const {
+        return _pendingSize;
+    }
+
+private:
+
+    /**
+     * Checking bytes are prefix of valid sequence, which needs more bytes
+     * @param bytes Bytes
+     * @param size Bytes count (1..4)
+     * @return Is truncated sequence
+     */
+    template<typename ByteT>
+    static inline constexpr Bool IsTruncatedUTF8(ConstPtr<ByteT> bytes, ConstLRef<U64> size) {
+        auto lead = StaticCast<U8>(bytes[0]);
+
+        if (lead < 0xC2 || UTF8Size(lead) <= size) {
+            return false;
+        }
+
+        U32 codePoint;
+
+        return FromUTF8(bytes, size, codePoint) == size;
+    }
+
+private:
+
+    Array<U8, 4> _pending;
+
+    U64 _pendingSize;
+};
+
+/**
+ * Incremental UTF-8 encoder for chunked input of code points or UTF-16 code units
+ *
+ * Surrogate pairs split between chunks of UTF-16 are kept until next chunk.
+ * Invalid code points and unpaired surrogates are replaced with U+FFFD
+ */
+class UTF8Encoder {
+public:
+
+    constexpr UTF8Encoder()
+            : _pendingSurrogate(0) {}
+
+public:
+
+    /**
+     * Encoding chunk of code points
+     * @param codePoints Code points
+     * @param size Code points count
+     * @param output Output bytes (at least UTF32ToUTF8Length(codePoints, size) + PendingOutputSize() bytes)
+     * @return Bytes count
+     */
+    template<typename CodePointT, typename ByteT>
+    inline constexpr U64 Encode(ConstPtr<CodePointT> codePoints, ConstLRef<U64> size, Ptr<ByteT> output) {
+        auto count = Finish(output);
+
+        return count + UTF32ToUTF8(codePoints, size, output + count);
+    }
+
+    /**
+     * Encoding chunk of UTF-16 code units
+     * @tparam ByteOrderV Byte order of code units
+     * @param units Code units
+     * @param size Code units count
+     * @param output Output bytes (at least MaxOutputSize(size) bytes)
+     * @return Bytes count
+     */
+    template<std::endian ByteOrderV = std::endian::native, typename UnitT, typename ByteT>
+    inline constexpr U64 EncodeUTF16(ConstPtr<UnitT> units, ConstLRef<U64> size, Ptr<ByteT> output) {
+        if (size == 0) {
+            return 0;
+        }
+
+        U64 position = 0, count = 0;
+
+        if (_pendingSurrogate != 0) {
+            auto unit = LoadUTF16Unit<ByteOrderV>(units, 0);
+
+            if (IsLowSurrogate(unit)) {
+                count += EncodeUTF8(0x10000 + ((_pendingSurrogate - 0xD800) << 10) + (unit - 0xDC00), output);
+
+                position = 1;
+
+                _pendingSurrogate = 0;
+            } else {
+                count += Finish(output);
+            }
+        }
+
+        auto end = size;
+
+        if (end > position && IsHighSurrogate(LoadUTF16Unit<ByteOrderV>(units, end - 1))) {
+            --end;
+
+            _pendingSurrogate = LoadUTF16Unit<ByteOrderV>(units, end);
+        }
+
+        return count + UTF16ToUTF8<ByteOrderV>(units + position, end - position, output + count);
+    }
+
+    /**
+     * Finishing input, pending high surrogate is replaced with U+FFFD
+     * @param output Output bytes (at least PendingOutputSize() bytes)
+     * @return Bytes count
+     */
+    template<typename ByteT>
+    inline constexpr U64 Finish(Ptr<ByteT> output) {
+        if (_pendingSurrogate == 0) {
+            return 0;
+        }
+
+        _pendingSurrogate = 0;
+
+        return EncodeUTF8(ReplacementCodePoint, output);
+    }
+
+    inline constexpr Void Reset() {
+        _pendingSurrogate = 0;
+    }
+
+public:
+
+    /**
+     * Maximum bytes count of EncodeUTF16 for chunk
+     * @param size Code units count of chunk
+     * @return Bytes count
+     */
+    inline constexpr U64 MaxOutputSize(ConstLRef<U64> size) const {
+        return size * 3 + PendingOutputSize();
+    }
+
+    inline constexpr U64 PendingOutputSize() const {
+        return _pendingSurrogate != 0 ? 3 : 0;
+    }
+
+private:
+
+    U32 _pendingSurrogate;
+};
+
+#endif //GSCROSSPLATFORM_UTF8CODEC_H
@@ -0,0 +1,182 @@
+#ifndef GSCROSSPLATFORM_UTF8VIEW_H
+#define GSCROSSPLATFORM_UTF8VIEW_H
+
+#include <GSCrossPlatform/UString.h>
+
+/**
+ * Non owning view of validated UTF-8 bytes
+ *
+ * Bytes are validated once on construction, symbols are decoded lazily by iterator or on demand by Decode
+ */
+class UTF8View {
+public:
+
+    class Iterator {
+    public:
+
+        constexpr Iterator()
+                : _bytes(nullptr), _size(0) {}
+
+        constexpr Iterator(ConstPtr<U8> bytes, ConstLRef<U64> size)
+                : _bytes(bytes), _size(size) {}
+
+    public:
+
+        inline constexpr USymbol operator*() const {
+            U32 codePoint;
+
+            FromUTF8(_bytes, _size, codePoint);
+
+            return USymbol(codePoint);
+        }
+
+        inline constexpr LRef<Iterator> operator++() {
+            auto symbolSize = UTF8Size(_bytes[0]);
+
+            _bytes += symbolSize;
+
+            _size -= symbolSize;
+
+            return *this;
+        }
+
+        inline constexpr Iterator operator++(I32) {
+            auto iterator = *this;
+
+            ++*this;
+
+            return iterator;
+        }
+
+        inline constexpr Bool operator==(ConstLRef<Iterator> iterator) const {
+            return _bytes == iterator._bytes;
+        }
+
+        inline constexpr Bool operator!=(ConstLRef<Iterator> iterator) const {
+            return !operator==(iterator);
+        }
+
+    private:
+
+        ConstPtr<U8> _bytes;
+
+        U64 _size;
+    };
+
+public:
+
+    constexpr UTF8View()
+            : _bytes(nullptr), _size(0) {}
+
+    /**
+     * Constructor for view of UTF-8 bytes
+     * @param bytes Bytes (must be valid UTF-8)
+     * @param size Bytes count
+     */
+    constexpr UTF8View(ConstPtr<U8> bytes, ConstLRef<U64> size)
+            : _bytes(bytes), _size(size) {
+        if (!IsValidUTF8(_bytes, _size)) {
+            throw std::runtime_error("UTF8View::UTF8View(ConstPtr<U8>, ConstLRef<U64>): Invalid UTF-8!");
+        }
+    }
+
+public:
+
+    /**
+     * Creating view of bytes without validation
+     * @param bytes Bytes (must be valid UTF-8)
+     * @param size Bytes count
+     * @return View
+     */
+    static inline constexpr UTF8View FromValid(ConstPtr<U8> bytes, ConstLRef<U64> size) {
+        UTF8View view;
+
+        view._bytes = bytes;
+
+        view._size = size;
+
+        return view;
+    }
+
+public:
+
+    /**
+     * Getting part of view by byte offsets
+     * @param offset Byte offset (must be on symbol boundary)
+     * @param size Bytes count (end must be on symbol boundary)
+     * @return View
+     */
+    inline constexpr UTF8View Substring(ConstLRef<U64> offset, ConstLRef<U64> size) const {
+        if (offset > _size) {
+            throw std::runtime_error("UTF8View::Substring(ConstLRef<U64>, ConstLRef<U64>) const: Offset out of range!");
+        }
+
+        auto end = size < _size - offset ? offset + size : _size;
+
+        if (!IsBoundary(offset) || !IsBoundary(end)) {
+            throw std::runtime_error("UTF8View::Substring(ConstLRef<U64>, ConstLRef<U64>) const: Offsets must be on symbol boundaries!");
+        }
+
+        return FromValid(_bytes + offset, end - offset);
+    }
+
+    /**
+     * Decoding view into string
+     * @return String
+     */
+    inline constexpr UString Decode() const {
+        UString string;
+
+        string.Resize(CountUTF8Symbols(_bytes, _size));
+
+        UTF8ToUTF32(_bytes, _size, string.Data());
+
+        return string;
+    }
+
+    /**
+     * Counting symbols in view
+     * @return Symbols count
+     */
+    inline constexpr U64 Length() const {
+        return CountUTF8Symbols(_bytes, _size);
+    }
+
+public:
+
+    inline constexpr ConstPtr<U8> Data() const {
+        return _bytes;
+    }
+
+    inline constexpr U64 Size() const {
+        return _size;
+    }
+
+    inline constexpr Bool Empty() const {
+        return _size == 0;
+    }
+
+public:
+
+    inline constexpr Iterator begin() const {
+        return Iterator(_bytes, _size);
+    }
+
+    inline constexpr Iterator end() const {
+        return Iterator(_bytes + _size, 0);
+    }
+
+private:
+
+    inline constexpr Bool IsBoundary(ConstLRef<U64> offset) const {
+        return offset == _size || (_bytes[offset] & 0xC0) != 0x80;
+    }
+
+private:
+
+    ConstPtr<U8> _bytes;
+
+    U64 _size;
+};
+
+#endif //GSCROSSPLATFORM_UTF8VIEW_H
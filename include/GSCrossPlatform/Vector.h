@@ -2,6 +2,7 @@
 #define GSCROSSPLATFORM_VECTOR_H
 
 #include <stdexcept>
+#include <utility>
 
 #include <GSCrossPlatform/Types.h>
 
@@ -73,28 +74,13 @@ public:
         }
     }
 
-    constexpr Vector(RRef<Vector<ValueType>> vector) noexcept {
-        if (this == &vector) {
-            return;
-        }
-
-        _size = vector.Size();
+    constexpr Vector(RRef<Vector<ValueType>> vector) noexcept
+            : _data(vector._data), _size(vector._size), _allocatedSize(vector._allocatedSize) {
+        vector._data = nullptr;
 
-        if (_size > 0) {
-            _allocatedSize = AlignSize(_size);
-
-            _data = new ValueType[_allocatedSize];
+        vector._size = 0;
 
-            for (U64 index = 0; auto &value : vector) {
-                _data[index] = std::move(value);
-
-                ++index;
-            }
-        } else {
-            _allocatedSize = 0;
-
-            _data = nullptr;
-        }
+        vector._allocatedSize = 0;
     }
 
 public:
@@ -107,24 +93,26 @@ public:
 
     constexpr LRef<Vector<ValueType>> Append(ConstLRef<ValueType> value) {
         if (_size == _allocatedSize) {
-            _allocatedSize += ChunkSize;
-
-            auto newData = new ValueType[_allocatedSize];
+            Reserve(GrowSize(_size + 1));
+        }
 
-            for (U64 index = 0; auto &vectorValue : *this) {
-                newData[index] = vectorValue;
+        ++_size;
 
-                ++index;
-            }
+        _data[_size - 1] = value;
 
-            delete[] _data;
+        return *this;
+    }
 
-            _data = newData;
+    constexpr LRef<Vector<ValueType>> Append(ConstPtr<ValueType> values, ConstLRef<U64> size) {
+        if (_size + size > _allocatedSize) {
+            Reserve(GrowSize(_size + size));
         }
 
-        ++_size;
+        for (U64 index = 0; index < size; ++index) {
+            _data[_size + index] = values[index];
+        }
 
-        _data[_size - 1] = value;
+        _size += size;
 
         return *this;
     }
@@ -137,6 +125,41 @@ public:
         return *this;
     }
 
+    constexpr LRef<Vector<ValueType>> Reserve(ConstLRef<U64> size) {
+        if (size <= _allocatedSize) {
+            return *this;
+        }
+
+        _allocatedSize = AlignSize(size);
+
+        auto newData = new ValueType[_allocatedSize];
+
+        for (U64 index = 0; auto &vectorValue : *this) {
+            newData[index] = std::move(vectorValue);
+
+            ++index;
+        }
+
+        delete[] _data;
+
+        _data = newData;
+
+        return *this;
+    }
+
+    /**
+     * Resizing vector, new elements have unspecified values and must be assigned by caller
+     * @param size New size
+     * @return Vector
+     */
+    constexpr LRef<Vector<ValueType>> Resize(ConstLRef<U64> size) {
+        Reserve(size);
+
+        _size = size;
+
+        return *this;
+    }
+
     constexpr Void Clear() {
         delete[] _data;
 
@@ -153,10 +176,18 @@ public:
         return _data;
     }
 
+    inline constexpr ConstPtr<ValueType> Data() const {
+        return _data;
+    }
+
     inline constexpr U64 Size() const {
         return _size;
     }
 
+    inline constexpr U64 Capacity() const {
+        return _allocatedSize;
+    }
+
     inline constexpr Bool Empty() const {
         return _size == 0;
     }
@@ -224,23 +255,17 @@ public:
 
         delete[] _data;
 
-        _size = vector.Size();
+        _data = vector._data;
 
-        if (_size > 0) {
-            _allocatedSize = AlignSize(_size);
+        _size = vector._size;
 
-            _data = new ValueType[_allocatedSize];
+        _allocatedSize = vector._allocatedSize;
 
-            for (U64 index = 0; auto &value : vector) {
-                _data[index] = std::move(value);
+        vector._data = nullptr;
 
-                ++index;
-            }
-        } else {
-            _allocatedSize = 0;
+        vector._size = 0;
 
-            _data = nullptr;
-        }
+        vector._allocatedSize = 0;
 
         return *this;
     }
@@ -287,6 +312,12 @@ private:
         return (size / ChunkSize + ((size % ChunkSize) > 0 ? 1 : 0)) * ChunkSize;
     }
 
+    inline constexpr U64 GrowSize(ConstLRef<U64> size) const {
+        auto doubledSize = _allocatedSize * 2;
+
+        return size > doubledSize ? size : doubledSize;
+    }
+
 private:
 
     Ptr<ValueType> _data;
@@ -0,0 +1,598 @@
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdio>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <GSCrossPlatform/AsyncFileReader.h>
+
+#if !defined(GS_OS_WINDOWS)
+
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+#endif
+
+#if defined(__linux__)
+
+    #include <linux/io_uring.h>
+    #include <sys/mman.h>
+    #include <sys/syscall.h>
+
+    #define GS_ASYNC_FILE_READER_IO_URING
+
+#endif
+
+/**
+ * Minimum bytes count of one read request
+ */
+static constexpr U64 AsyncFileReadSize = 64 * 1024;
+
+/**
+ * Maximum bytes count of one io_uring read request
+ */
+static constexpr U64 AsyncFileMaxReadSize = 1U << 30;
+
+/**
+ * Maximum queue depth (io_uring limits count of submission queue entries)
+ */
+static constexpr U32 AsyncFileMaxQueueDepth = 4096;
+
+/**
+ * Growing buffer for next read request
+ * @param bytes Buffer
+ * @param size Count of read bytes
+ */
+static Void ReserveReadSpace(LRef<Vector<U8>> bytes, ConstLRef<U64> size) {
+    if (bytes.Size() - size < AsyncFileReadSize) {
+        bytes.Resize(size * 2 > size + AsyncFileReadSize ? size * 2 : size + AsyncFileReadSize);
+    }
+}
+
+/**
+ * Reading file synchronously (used by thread pool backend)
+ * @param path Path to file
+ * @return Result
+ */
+static AsyncFileResult ReadFileSync(ConstLRef<std::string> path) {
+    Vector<U8> bytes;
+
+    U64 size = 0;
+
+#if defined(GS_OS_WINDOWS)
+
+    auto file = std::fopen(path.c_str(), "rb");
+
+    if (file == nullptr) {
+        return AsyncFileResult(path, Vector<U8>(), errno != 0 ? errno : ENOENT);
+    }
+
+    while (true) {
+        ReserveReadSpace(bytes, size);
+
+        auto result = std::fread(bytes.Data() + size, 1, bytes.Size() - size, file);
+
+        size += result;
+
+        if (result == 0) {
+            break;
+        }
+    }
+
+    auto error = std::ferror(file) ? EIO : 0;
+
+    std::fclose(file);
+
+#else
+
+    auto fileDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fileDescriptor < 0) {
+        return AsyncFileResult(path, Vector<U8>(), errno);
+    }
+
+    struct stat fileStat {};
+
+    if (fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0) {
+        // one more byte for detecting end of file without additional growth
+        bytes.Resize(StaticCast<U64>(fileStat.st_size) + 1);
+    }
+
+    auto error = 0;
+
+    while (true) {
+        ReserveReadSpace(bytes, size);
+
+        auto result = pread(fileDescriptor, bytes.Data() + size, bytes.Size() - size, StaticCast<off_t>(size));
+
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            error = errno;
+
+            break;
+        }
+
+        if (result == 0) {
+            break;
+        }
+
+        size += StaticCast<U64>(result);
+    }
+
+    close(fileDescriptor);
+
+#endif
+
+    bytes.Resize(size);
+
+    return AsyncFileResult(path, std::move(bytes), error);
+}
+
+#if defined(GS_ASYNC_FILE_READER_IO_URING)
+
+/**
+ * io_uring instance on raw system calls
+ */
+class AsyncFileReader::IOUring {
+public:
+
+    explicit IOUring(ConstLRef<U32> entriesCount) {
+        io_uring_params params {};
+
+        _fileDescriptor = StaticCast<I32>(syscall(__NR_io_uring_setup, entriesCount, &params));
+
+        if (_fileDescriptor < 0) {
+            throw std::runtime_error("AsyncFileReader::IOUring::IOUring(ConstLRef<U32>): Can't create io_uring!");
+        }
+
+        // IORING_OP_OPENAT, IORING_OP_READ and IORING_OP_CLOSE are available since same kernel version as this feature
+        if ((params.features & IORING_FEAT_RW_CUR_POS) == 0 || (params.features & IORING_FEAT_SINGLE_MMAP) == 0) {
+            close(_fileDescriptor);
+
+            throw std::runtime_error("AsyncFileReader::IOUring::IOUring(ConstLRef<U32>): Unsupported io_uring version!");
+        }
+
+        auto submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(U32);
+
+        auto completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+        _ringSize = submissionRingSize > completionRingSize ? submissionRingSize : completionRingSize;
+
+        _ring = mmap(nullptr, _ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fileDescriptor, IORING_OFF_SQ_RING);
+
+        if (_ring == MAP_FAILED) {
+            close(_fileDescriptor);
+
+            throw std::runtime_error("AsyncFileReader::IOUring::IOUring(ConstLRef<U32>): Can't map io_uring rings!");
+        }
+
+        _entriesSize = params.sq_entries * sizeof(io_uring_sqe);
+
+        auto entries = mmap(nullptr, _entriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fileDescriptor, IORING_OFF_SQES);
+
+        if (entries == MAP_FAILED) {
+            munmap(_ring, _ringSize);
+
+            close(_fileDescriptor);
+
+            throw std::runtime_error("AsyncFileReader::IOUring::IOUring(ConstLRef<U32>): Can't map io_uring submission entries!");
+        }
+
+        auto ring = StaticCast<Ptr<U8>>(_ring);
+
+        _entries = StaticCast<Ptr<io_uring_sqe>>(entries);
+
+        _submissionTail = ReinterpretCast<Ptr<U32>>(ring + params.sq_off.tail);
+
+        _submissionMask = *ReinterpretCast<Ptr<U32>>(ring + params.sq_off.ring_mask);
+
+        _submissionArray = ReinterpretCast<Ptr<U32>>(ring + params.sq_off.array);
+
+        _completionHead = ReinterpretCast<Ptr<U32>>(ring + params.cq_off.head);
+
+        _completionTail = ReinterpretCast<Ptr<U32>>(ring + params.cq_off.tail);
+
+        _completionMask = *ReinterpretCast<Ptr<U32>>(ring + params.cq_off.ring_mask);
+
+        _completions = ReinterpretCast<Ptr<io_uring_cqe>>(ring + params.cq_off.cqes);
+
+        _submissionLocalTail = *_submissionTail;
+
+        _pendingCount = 0;
+    }
+
+public:
+
+    ~IOUring() {
+        munmap(_entries, _entriesSize);
+
+        munmap(_ring, _ringSize);
+
+        close(_fileDescriptor);
+    }
+
+public:
+
+    /**
+     * Getting next submission entry (entry is published by Enter)
+     * @param userData User data of request
+     * @return Cleared entry
+     */
+    inline Ptr<io_uring_sqe> NextSubmission(ConstLRef<U64> userData) {
+        auto index = _submissionLocalTail & _submissionMask;
+
+        auto entry = &_entries[index];
+
+        *entry = io_uring_sqe {};
+
+        entry->user_data = userData;
+
+        _submissionArray[index] = index;
+
+        ++_submissionLocalTail;
+
+        ++_pendingCount;
+
+        return entry;
+    }
+
+    /**
+     * Submitting pending entries and waiting for completions
+     * @param minCompletions Minimum completions count for waiting
+     */
+    inline Void Enter(ConstLRef<U32> minCompletions) {
+        std::atomic_ref<U32>(*_submissionTail).store(_submissionLocalTail, std::memory_order_release);
+
+        do {
+            auto result = syscall(__NR_io_uring_enter, _fileDescriptor, _pendingCount, minCompletions, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+            if (result < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                throw std::runtime_error("AsyncFileReader::IOUring::Enter(ConstLRef<U32>): Can't enter io_uring!");
+            }
+
+            _pendingCount -= StaticCast<U32>(result);
+        } while (_pendingCount > 0);
+    }
+
+    /**
+     * Getting next completion
+     * @param userData User data of request
+     * @param result Result of request
+     * @return Is completion available
+     */
+    inline Bool NextCompletion(LRef<U64> userData, LRef<I32> result) {
+        auto head = *_completionHead;
+
+        if (head == std::atomic_ref<U32>(*_completionTail).load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        auto &completion = _completions[head & _completionMask];
+
+        userData = completion.user_data;
+
+        result = completion.res;
+
+        std::atomic_ref<U32>(*_completionHead).store(head + 1, std::memory_order_release);
+
+        return true;
+    }
+
+private:
+
+    I32 _fileDescriptor;
+
+    Ptr<Void> _ring;
+
+    U64 _ringSize;
+
+    Ptr<io_uring_sqe> _entries;
+
+    U64 _entriesSize;
+
+    Ptr<U32> _submissionTail;
+
+    U32 _submissionLocalTail;
+
+    U32 _submissionMask;
+
+    Ptr<U32> _submissionArray;
+
+    Ptr<U32> _completionHead;
+
+    Ptr<U32> _completionTail;
+
+    U32 _completionMask;
+
+    Ptr<io_uring_cqe> _completions;
+
+    U32 _pendingCount;
+};
+
+#else
+
+class AsyncFileReader::IOUring {
+public:
+
+    explicit IOUring(ConstLRef<U32>) {
+        throw std::runtime_error("AsyncFileReader::IOUring::IOUring(ConstLRef<U32>): io_uring is not supported on this OS!");
+    }
+};
+
+#endif
+
+AsyncFileReader::AsyncFileReader(U32 queueDepth, U32 threadsCount, AsyncFileBackend backend)
+        : _backend(AsyncFileBackend::ThreadPool),
+          _queueDepth(queueDepth == 0 ? 1 : queueDepth < AsyncFileMaxQueueDepth ? queueDepth : AsyncFileMaxQueueDepth),
+          _threadsCount(threadsCount != 0 ? threadsCount : std::thread::hardware_concurrency()),
+          _ring(nullptr) {
+    if (_threadsCount == 0) {
+        _threadsCount = 1;
+    }
+
+    if (backend == AsyncFileBackend::ThreadPool) {
+        return;
+    }
+
+    try {
+        _ring = new IOUring(_queueDepth);
+
+        _backend = AsyncFileBackend::IOUring;
+    } catch (ConstLRef<std::runtime_error>) {
+        // io_uring can be disabled by kernel or sandbox, so thread pool is used by Auto backend
+        if (backend == AsyncFileBackend::IOUring) {
+            throw;
+        }
+    }
+}
+
+AsyncFileReader::~AsyncFileReader() {
+    delete _ring;
+}
+
+Void AsyncFileReader::Submit(std::string path, Callback callback) {
+    _requests.Append(Pair<std::string, Callback>(std::move(path), std::move(callback)));
+}
+
+std::future<AsyncFileResult> AsyncFileReader::Submit(std::string path) {
+    auto promise = std::make_shared<std::promise<AsyncFileResult>>();
+
+    auto future = promise->get_future();
+
+    Submit(std::move(path), [promise] (RRef<AsyncFileResult> result) {
+        promise->set_value(std::move(result));
+    });
+
+    return future;
+}
+
+Void AsyncFileReader::Run() {
+    if (_requests.Empty()) {
+        return;
+    }
+
+    // callbacks can submit new requests, they are queued for next Run
+    auto requests = std::move(_requests);
+
+    if (_backend == AsyncFileBackend::IOUring) {
+        RunIOUring(requests);
+    } else {
+        RunThreadPool(requests);
+    }
+}
+
+Void AsyncFileReader::RunIOUring([[maybe_unused]] LRef<Vector<Pair<std::string, Callback>>> requests) {
+#if defined(GS_ASYNC_FILE_READER_IO_URING)
+
+    enum class Stage : U8 {
+        Open,
+        Read,
+        Close
+    };
+
+    auto requestsCount = requests.Size();
+
+    std::vector<Stage> stages(requestsCount, Stage::Open);
+
+    std::vector<I32> fileDescriptors(requestsCount, -1), errors(requestsCount, 0);
+
+    std::vector<U64> sizes(requestsCount, 0);
+
+    std::vector<Vector<U8>> buffers(requestsCount);
+
+    auto submitRead = [&] (ConstLRef<U64> index) {
+        ReserveReadSpace(buffers[index], sizes[index]);
+
+        auto entry = _ring->NextSubmission(index);
+
+        entry->opcode = IORING_OP_READ;
+
+        entry->fd = fileDescriptors[index];
+
+        entry->addr = ReinterpretCast<U64>(buffers[index].Data() + sizes[index]);
+
+        auto readSize = buffers[index].Size() - sizes[index];
+
+        entry->len = StaticCast<U32>(readSize < AsyncFileMaxReadSize ? readSize : AsyncFileMaxReadSize);
+
+        entry->off = sizes[index];
+    };
+
+    auto submitClose = [&] (ConstLRef<U64> index) {
+        stages[index] = Stage::Close;
+
+        auto entry = _ring->NextSubmission(index);
+
+        entry->opcode = IORING_OP_CLOSE;
+
+        entry->fd = fileDescriptors[index];
+    };
+
+    U64 nextIndex = 0, inFlightCount = 0;
+
+    std::exception_ptr exception;
+
+    while (nextIndex < requestsCount || inFlightCount > 0) {
+        // every file in flight has exactly one request in queue
+        for (; nextIndex < requestsCount && inFlightCount < _queueDepth; ++nextIndex, ++inFlightCount) {
+            auto entry = _ring->NextSubmission(nextIndex);
+
+            entry->opcode = IORING_OP_OPENAT;
+
+            entry->fd = AT_FDCWD;
+
+            entry->addr = ReinterpretCast<U64>(requests[nextIndex].Key().c_str());
+
+            entry->open_flags = O_RDONLY | O_CLOEXEC;
+        }
+
+        _ring->Enter(1);
+
+        U64 index;
+
+        I32 result;
+
+        while (_ring->NextCompletion(index, result)) {
+            if (stages[index] == Stage::Open) {
+                if (result < 0) {
+                    errors[index] = -result;
+
+                    stages[index] = Stage::Close;
+
+                    fileDescriptors[index] = -1;
+                } else {
+                    fileDescriptors[index] = result;
+
+                    stages[index] = Stage::Read;
+
+                    submitRead(index);
+
+                    continue;
+                }
+            } else if (stages[index] == Stage::Read) {
+                if (result > 0) {
+                    sizes[index] += StaticCast<U64>(result);
+
+                    submitRead(index);
+                } else {
+                    if (result < 0) {
+                        errors[index] = -result;
+                    }
+
+                    submitClose(index);
+                }
+
+                continue;
+            }
+
+            --inFlightCount;
+
+            buffers[index].Resize(sizes[index]);
+
+            auto &request = requests[index];
+
+            // kernel can still write into buffers of files in flight, so exception is rethrown after all completions
+            try {
+                if (!exception) {
+                    request.Value()(AsyncFileResult(std::move(request.Key()), std::move(buffers[index]), errors[index]));
+                }
+            } catch (...) {
+                exception = std::current_exception();
+            }
+        }
+    }
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+
+#endif
+}
+
+Void AsyncFileReader::RunThreadPool(LRef<Vector<Pair<std::string, Callback>>> requests) {
+    auto requestsCount = requests.Size();
+
+    std::vector<AsyncFileResult> results(requestsCount);
+
+    std::vector<U64> completedIndices;
+
+    std::atomic<U64> nextIndex = 0;
+
+    std::mutex mutex;
+
+    std::condition_variable condition;
+
+    auto threadsCount = _threadsCount < requestsCount ? _threadsCount : requestsCount;
+
+    std::vector<std::thread> threads;
+
+    threads.reserve(threadsCount);
+
+    for (U64 threadIndex = 0; threadIndex < threadsCount; ++threadIndex) {
+        threads.emplace_back([&] () {
+            for (auto index = nextIndex++; index < requestsCount; index = nextIndex++) {
+                results[index] = ReadFileSync(requests[index].Key());
+
+                {
+                    std::lock_guard lock(mutex);
+
+                    completedIndices.push_back(index);
+                }
+
+                condition.notify_one();
+            }
+        });
+    }
+
+    std::vector<U64> indices;
+
+    std::exception_ptr exception;
+
+    for (U64 completedCount = 0; completedCount < requestsCount;) {
+        {
+            std::unique_lock lock(mutex);
+
+            condition.wait(lock, [&] () {
+                return !completedIndices.empty();
+            });
+
+            indices.swap(completedIndices);
+        }
+
+        // workers reference local state, so exception is rethrown after joining them
+        for (auto index : indices) {
+            try {
+                if (!exception) {
+                    requests[index].Value()(std::move(results[index]));
+                }
+            } catch (...) {
+                exception = std::current_exception();
+            }
+        }
+
+        completedCount += indices.size();
+
+        indices.clear();
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    if (exception) {
+        std::rethrow_exception(exception);
+    }
+}
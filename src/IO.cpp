@@ -1,11 +1,428 @@
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
 #include <GSCrossPlatform/IO.h>
 
 #if defined(GS_OS_WINDOWS)
 
     #include <Windows.h>
+    #include <io.h>
+
+#else
+
+    #include <sys/uio.h>
+    #include <unistd.h>
+
+#endif
+
+UTF8Reader::UTF8Reader(I32 fileDescriptor, Bool normalizeNewLines)
+        : _sourceType(SourceType::FileDescriptor),
+          _fileDescriptor(fileDescriptor),
+          _file(nullptr),
+          _streamBuffer(nullptr),
+          _normalizeNewLines(normalizeNewLines),
+          _pendingCarriageReturn(false),
+          _isEndOfInput(false),
+          _symbolsCount(0),
+          _position(0) {
+    _bytes.Resize(BufferSize);
+
+    // decoded block can contain pending sequence, pending carriage return and replacement symbol at end of input
+    _symbols.Resize(BufferSize + 8);
+}
+
+UTF8Reader::UTF8Reader(Ptr<std::FILE> file, Bool normalizeNewLines)
+        : UTF8Reader(-1, normalizeNewLines) {
+    _sourceType = SourceType::File;
+
+    _file = file;
+}
+
+UTF8Reader::UTF8Reader(Ptr<std::streambuf> streamBuffer, Bool normalizeNewLines)
+        : UTF8Reader(-1, normalizeNewLines) {
+    _sourceType = SourceType::StreamBuffer;
+
+    _streamBuffer = streamBuffer;
+}
+
+UTF8Reader::UTF8Reader(LRef<std::istream> stream, Bool normalizeNewLines)
+        : UTF8Reader(stream.rdbuf(), normalizeNewLines) {}
+
+Bool UTF8Reader::ReadSymbol(LRef<USymbol> symbol) {
+    if (_position == _symbolsCount && !Fill()) {
+        return false;
+    }
+
+    symbol = _symbols.Data()[_position++];
+
+    return true;
+}
+
+Bool UTF8Reader::Peek(LRef<USymbol> symbol) {
+    if (_position == _symbolsCount && !Fill()) {
+        return false;
+    }
+
+    symbol = _symbols.Data()[_position];
+
+    return true;
+}
+
+Bool UTF8Reader::ReadLine(LRef<UString> line) {
+    line = UString();
+
+    auto isLineRead = false;
+
+    while (_position < _symbolsCount || Fill()) {
+        isLineRead = true;
+
+        auto begin = _symbols.Data() + _position, end = _symbols.Data() + _symbolsCount;
+
+        auto lineEnd = begin;
+
+        while (lineEnd != end && lineEnd->CodePoint() != '\n') {
+            ++lineEnd;
+        }
+
+        line.Append(UStringView(begin, lineEnd - begin));
+
+        _position += lineEnd - begin;
+
+        if (lineEnd != end) {
+            ++_position;
+
+            break;
+        }
+    }
+
+    return isLineRead;
+}
+
+UString UTF8Reader::ReadAll() {
+    UString string;
+
+    while (_position < _symbolsCount || Fill()) {
+        string.Append(UStringView(_symbols.Data() + _position, _symbolsCount - _position));
+
+        _position = _symbolsCount;
+    }
+
+    return string;
+}
+
+Bool UTF8Reader::IsEnd() {
+    return _position == _symbolsCount && !Fill();
+}
+
+Bool UTF8Reader::Fill() {
+    _position = 0;
+
+    _symbolsCount = 0;
+
+    while (_symbolsCount == 0) {
+        if (_isEndOfInput) {
+            return false;
+        }
+
+        auto symbols = _symbols.Data();
+
+        U64 count = 0;
+
+        if (_pendingCarriageReturn) {
+            symbols[count++] = USymbol('\r');
+
+            _pendingCarriageReturn = false;
+        }
+
+        auto bytesCount = ReadBytes(_bytes.Data(), BufferSize);
+
+        if (bytesCount == 0) {
+            _isEndOfInput = true;
+
+            count += _decoder.Finish(symbols + count);
+        } else {
+            count += _decoder.Decode(_bytes.Data(), bytesCount, symbols + count);
+        }
+
+        if (_normalizeNewLines) {
+            count = NormalizeNewLines(symbols, count);
+        }
+
+        _symbolsCount = count;
+    }
+
+    return true;
+}
+
+U64 UTF8Reader::ReadBytes(Ptr<U8> bytes, ConstLRef<U64> size) {
+    switch (_sourceType) {
+        case SourceType::FileDescriptor: {
+#if defined(GS_OS_WINDOWS)
+
+            auto result = _read(_fileDescriptor, bytes, StaticCast<unsigned>(size));
+
+#else
+
+            ssize_t result;
+
+            do {
+                result = read(_fileDescriptor, bytes, size);
+            } while (result < 0 && errno == EINTR);
+
+#endif
+
+            if (result < 0) {
+                throw std::runtime_error("UTF8Reader::ReadBytes(Ptr<U8>, ConstLRef<U64>): Can't read from file descriptor!");
+            }
+
+            return StaticCast<U64>(result);
+        }
+        case SourceType::File: {
+            auto result = std::fread(bytes, 1, size, _file);
+
+            if (result == 0 && std::ferror(_file)) {
+                throw std::runtime_error("UTF8Reader::ReadBytes(Ptr<U8>, ConstLRef<U64>): Can't read from file!");
+            }
+
+            return result;
+        }
+        case SourceType::StreamBuffer: {
+            auto result = _streamBuffer->sgetn(ReinterpretCast<Ptr<C>>(bytes), StaticCast<std::streamsize>(size));
+
+            return result > 0 ? StaticCast<U64>(result) : 0;
+        }
+    }
+
+    return 0;
+}
+
+U64 UTF8Reader::NormalizeNewLines(Ptr<USymbol> symbols, U64 size) {
+    U64 position = 0;
+
+    while (position < size && symbols[position].CodePoint() != '\r') {
+        ++position;
+    }
+
+    auto count = position;
+
+    for (; position < size; ++position) {
+        if (symbols[position].CodePoint() == '\r' && position + 1 < size && symbols[position + 1].CodePoint() == '\n') {
+            continue;
+        }
+
+        symbols[count++] = symbols[position];
+    }
+
+    // carriage return at end of block can be first part of CRLF split between blocks
+    if (!_isEndOfInput && count > 0 && symbols[count - 1].CodePoint() == '\r') {
+        _pendingCarriageReturn = true;
+
+        --count;
+    }
+
+    return count;
+}
+
+UTF8Writer::UTF8Writer(I32 fileDescriptor, UTF8WriterBuffering buffering)
+        : _destinationType(DestinationType::FileDescriptor),
+          _fileDescriptor(fileDescriptor),
+          _file(nullptr),
+          _streamBuffer(nullptr),
+          _buffering(buffering),
+          _size(0) {
+    _buffer.Resize(BufferSize);
+}
+
+UTF8Writer::UTF8Writer(Ptr<std::FILE> file, UTF8WriterBuffering buffering)
+        : UTF8Writer(-1, buffering) {
+    _destinationType = DestinationType::File;
+
+    _file = file;
+}
+
+UTF8Writer::UTF8Writer(Ptr<std::streambuf> streamBuffer, UTF8WriterBuffering buffering)
+        : UTF8Writer(-1, buffering) {
+    _destinationType = DestinationType::StreamBuffer;
+
+    _streamBuffer = streamBuffer;
+}
+
+UTF8Writer::UTF8Writer(LRef<std::ostream> stream, UTF8WriterBuffering buffering)
+        : UTF8Writer(stream.rdbuf(), buffering) {}
+
+UTF8Writer::~UTF8Writer() {
+    // errors can't be reported from destructor
+    try {
+        Flush();
+    } catch (ConstLRef<std::runtime_error>) {}
+}
+
+Void UTF8Writer::Write(ConstLRef<USymbol> symbol) {
+    if (BufferSize - _size < 4) {
+        Flush();
+    }
+
+    _size += EncodeUTF8(symbol.CodePoint(), _buffer.Data() + _size);
+
+    FlushIfNeeded(symbol.CodePoint() == '\n');
+}
+
+Void UTF8Writer::Write(ConstLRef<UStringView> view) {
+    auto symbols = view.Data();
+
+    auto hasLineFeed = false;
+
+    for (U64 position = 0; position < view.Size();) {
+        if (BufferSize - _size < 4) {
+            Flush();
+        }
+
+        // every symbol takes at most 4 bytes
+        auto count = (BufferSize - _size) / 4;
+
+        if (count > view.Size() - position) {
+            count = view.Size() - position;
+        }
+
+        if (_buffering == UTF8WriterBuffering::Line && !hasLineFeed) {
+            for (U64 index = position; index < position + count; ++index) {
+                if (symbols[index].CodePoint() == '\n') {
+                    hasLineFeed = true;
+
+                    break;
+                }
+            }
+        }
+
+        _size += UTF32ToUTF8(symbols + position, count, _buffer.Data() + _size);
+
+        position += count;
+    }
+
+    FlushIfNeeded(hasLineFeed);
+}
+
+Void UTF8Writer::Write(ConstLRef<UString> string) {
+    Write(UStringView(string));
+}
+
+Void UTF8Writer::WriteUTF8(ConstPtr<C> bytes, ConstLRef<U64> size) {
+    auto data = ReinterpretCast<ConstPtr<U8>>(bytes);
+
+    if (size > BufferSize - _size) {
+        // large data is written directly after buffered bytes
+        WriteBytes(_buffer.Data(), _size, data, size);
+
+        _size = 0;
+    } else {
+        std::memcpy(_buffer.Data() + _size, data, size);
+
+        _size += size;
+    }
+
+    // direct write can leave data in file or stream buffer too
+    FlushIfNeeded(_buffering == UTF8WriterBuffering::Line && std::memchr(data, '\n', size) != nullptr);
+}
+
+Void UTF8Writer::WriteLine(ConstLRef<UStringView> view) {
+    Write(view);
+
+    Write(USymbol('\n'));
+}
+
+Void UTF8Writer::Flush() {
+    if (_size > 0) {
+        WriteBytes(_buffer.Data(), _size, nullptr, 0);
+
+        _size = 0;
+    }
+
+    if (_destinationType == DestinationType::File) {
+        std::fflush(_file);
+    } else if (_destinationType == DestinationType::StreamBuffer) {
+        _streamBuffer->pubsync();
+    }
+}
+
+Void UTF8Writer::FlushIfNeeded(Bool hasLineFeed) {
+    if (_buffering == UTF8WriterBuffering::None || (_buffering == UTF8WriterBuffering::Line && hasLineFeed)) {
+        Flush();
+    }
+}
+
+Void UTF8Writer::WriteBytes(ConstPtr<U8> first, U64 firstSize, ConstPtr<U8> second, U64 secondSize) {
+    switch (_destinationType) {
+        case DestinationType::FileDescriptor: {
+#if defined(GS_OS_WINDOWS)
+
+            for (auto [data, size] : {std::pair(first, firstSize), std::pair(second, secondSize)}) {
+                while (size > 0) {
+                    auto result = _write(_fileDescriptor, data, StaticCast<unsigned>(size < 0x40000000 ? size : 0x40000000));
+
+                    if (result < 0) {
+                        throw std::runtime_error("UTF8Writer::WriteBytes(ConstPtr<U8>, U64, ConstPtr<U8>, U64): Can't write to file descriptor!");
+                    }
+
+                    data += result;
+
+                    size -= StaticCast<U64>(result);
+                }
+            }
+
+#else
+
+            while (firstSize + secondSize > 0) {
+                iovec parts[2] = {{const_cast<Ptr<U8>>(first), firstSize}, {const_cast<Ptr<U8>>(second), secondSize}};
+
+                auto result = firstSize > 0 ? writev(_fileDescriptor, parts, secondSize > 0 ? 2 : 1) : writev(_fileDescriptor, parts + 1, 1);
+
+                if (result < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+
+                    throw std::runtime_error("UTF8Writer::WriteBytes(ConstPtr<U8>, U64, ConstPtr<U8>, U64): Can't write to file descriptor!");
+                }
+
+                // skipping written part after partial write
+                auto written = StaticCast<U64>(result);
+
+                auto firstWritten = written < firstSize ? written : firstSize;
+
+                first += firstWritten;
+
+                firstSize -= firstWritten;
+
+                second += written - firstWritten;
+
+                secondSize -= written - firstWritten;
+            }
 
 #endif
 
+            break;
+        }
+        case DestinationType::File: {
+            if ((firstSize > 0 && std::fwrite(first, 1, firstSize, _file) != firstSize)
+                || (secondSize > 0 && std::fwrite(second, 1, secondSize, _file) != secondSize)) {
+                throw std::runtime_error("UTF8Writer::WriteBytes(ConstPtr<U8>, U64, ConstPtr<U8>, U64): Can't write to file!");
+            }
+
+            break;
+        }
+        case DestinationType::StreamBuffer: {
+            if (_streamBuffer->sputn(ReinterpretCast<ConstPtr<C>>(first), StaticCast<std::streamsize>(firstSize)) != StaticCast<std::streamsize>(firstSize)
+                || _streamBuffer->sputn(ReinterpretCast<ConstPtr<C>>(second), StaticCast<std::streamsize>(secondSize)) != StaticCast<std::streamsize>(secondSize)) {
+                throw std::runtime_error("UTF8Writer::WriteBytes(ConstPtr<U8>, U64, ConstPtr<U8>, U64): Can't write to stream buffer!");
+            }
+
+            break;
+        }
+    }
+}
+
 Bool EnableUnicodeConsole() {
 #if defined(GS_OS_WINDOWS)
 
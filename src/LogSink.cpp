@@ -0,0 +1,195 @@
+#include <algorithm>
+#include <bit>
+
+#include <GSCrossPlatform/LogSink.h>
+
+/**
+ * Cell of ring, sequence is equal to position for free cell and to position + 1 for published message
+ */
+class alignas(64) LogSink::Cell {
+public:
+
+    std::atomic<U64> Sequence;
+
+    LogLevel Level;
+
+    Vector<USymbol> Message;
+};
+
+/**
+ * Message prefixes of severity levels
+ */
+static constexpr ConstPtr<C> LogLevelPrefixes[] = {
+        "[TRACE] ",
+        "[DEBUG] ",
+        "[INFO] ",
+        "[WARNING] ",
+        "[ERROR] ",
+        "[FATAL] "
+};
+
+LogSink::LogSink(I32 fileDescriptor, LogLevel level, U64 capacity, LogDropPolicy dropPolicy)
+        : _cells(new Cell[std::bit_ceil(capacity < 2 ? 2 : capacity)]),
+          _mask(std::bit_ceil(capacity < 2 ? 2 : capacity) - 1),
+          _dropPolicy(dropPolicy),
+          _level(level),
+          _enqueuePosition(0),
+          _dequeuePosition(0),
+          _writtenPosition(0),
+          _droppedCount(0),
+          _isWaiting(false),
+          _signal(0),
+          _isStopping(false),
+          _writer(fileDescriptor) {
+    for (U64 index = 0; index <= _mask; ++index) {
+        _cells[index].Sequence.store(index, std::memory_order_relaxed);
+    }
+
+    _thread = std::thread(&LogSink::Run, this);
+}
+
+LogSink::~LogSink() {
+    _isStopping.store(true);
+
+    WakeUp();
+
+    _thread.join();
+}
+
+Bool LogSink::Log(LogLevel level, ConstLRef<UStringView> message) {
+    if (!IsEnabled(level)) {
+        return false;
+    }
+
+    auto position = _enqueuePosition.load(std::memory_order_relaxed);
+
+    Ptr<Cell> cell;
+
+    while (true) {
+        cell = &_cells[position & _mask];
+
+        auto sequence = cell->Sequence.load(std::memory_order_acquire);
+
+        auto difference = StaticCast<I64>(sequence - position);
+
+        if (difference == 0) {
+            if (_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // cell isn't written by background thread yet, so queue is full
+            if (_dropPolicy == LogDropPolicy::DropNewest) {
+                _droppedCount.fetch_add(1, std::memory_order_relaxed);
+
+                return false;
+            }
+
+            WakeUp();
+
+            std::this_thread::yield();
+
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        } else {
+            position = _enqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    cell->Level = level;
+
+    // message buffer of cell is reused, so allocation happens only for longer messages
+    cell->Message.Resize(message.Size());
+
+    std::copy(message.Data(), message.Data() + message.Size(), cell->Message.Data());
+
+    // sequentially consistent store is ordered before loading waiting flag in WakeUp
+    cell->Sequence.store(position + 1, std::memory_order_seq_cst);
+
+    if (_isWaiting.load(std::memory_order_seq_cst)) {
+        WakeUp();
+    }
+
+    return true;
+}
+
+Void LogSink::Flush() {
+    auto position = _enqueuePosition.load();
+
+    WakeUp();
+
+    for (auto writtenPosition = _writtenPosition.load(); writtenPosition < position; writtenPosition = _writtenPosition.load()) {
+        _writtenPosition.wait(writtenPosition);
+    }
+}
+
+Void LogSink::Run() {
+    while (true) {
+        if (Drain() > 0) {
+            continue;
+        }
+
+        if (_isStopping.load()) {
+            // messages published before stopping are written by last drain
+            if (Drain() == 0) {
+                break;
+            }
+
+            continue;
+        }
+
+        auto signal = _signal.load();
+
+        _isWaiting.store(true, std::memory_order_seq_cst);
+
+        if (_cells[_dequeuePosition & _mask].Sequence.load(std::memory_order_seq_cst) != _dequeuePosition + 1 && !_isStopping.load()) {
+            _signal.wait(signal);
+        }
+
+        _isWaiting.store(false, std::memory_order_relaxed);
+    }
+}
+
+U64 LogSink::Drain() {
+    U64 count = 0;
+
+    while (true) {
+        auto &cell = _cells[_dequeuePosition & _mask];
+
+        if (cell.Sequence.load(std::memory_order_acquire) != _dequeuePosition + 1) {
+            break;
+        }
+
+        auto prefix = LogLevelPrefixes[StaticCast<U8>(cell.Level)];
+
+        // write errors can't be reported from background thread, so failed messages are lost
+        try {
+            _writer.WriteUTF8(prefix, std::char_traits<C>::length(prefix));
+
+            _writer.WriteLine(UStringView(cell.Message.Data(), cell.Message.Size()));
+        } catch (ConstLRef<std::runtime_error>) {}
+
+        // cell is free for position of next round
+        cell.Sequence.store(_dequeuePosition + _mask + 1, std::memory_order_release);
+
+        ++_dequeuePosition;
+
+        ++count;
+    }
+
+    if (count > 0) {
+        try {
+            _writer.Flush();
+        } catch (ConstLRef<std::runtime_error>) {}
+
+        _writtenPosition.store(_dequeuePosition);
+
+        _writtenPosition.notify_all();
+    }
+
+    return count;
+}
+
+Void LogSink::WakeUp() {
+    _signal.fetch_add(1);
+
+    _signal.notify_one();
+}
@@ -0,0 +1,227 @@
+#include <stdexcept>
+
+#include <GSCrossPlatform/MappedFile.h>
+
+#if defined(GS_OS_WINDOWS)
+
+    #include <Windows.h>
+
+#else
+
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+
+#endif
+
+MappedFile::MappedFile()
+        : _data(nullptr), _size(0), _isOpen(false) {
+#if defined(GS_OS_WINDOWS)
+
+    _fileHandle = nullptr;
+
+    _mappingHandle = nullptr;
+
+#endif
+}
+
+MappedFile::MappedFile(ConstLRef<std::string> path, MappedFileAccess access, Bool useHugePages)
+        : MappedFile() {
+#if defined(GS_OS_WINDOWS)
+
+    auto flags = access == MappedFileAccess::Sequential ? FILE_FLAG_SEQUENTIAL_SCAN
+                 : access == MappedFileAccess::Random ? FILE_FLAG_RANDOM_ACCESS
+                 : FILE_ATTRIBUTE_NORMAL;
+
+    auto fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("MappedFile::MappedFile(ConstLRef<std::string>, MappedFileAccess, Bool): Can't open file!");
+    }
+
+    LARGE_INTEGER fileSize;
+
+    if (GetFileSizeEx(fileHandle, &fileSize) == FALSE) {
+        CloseHandle(fileHandle);
+
+        throw std::runtime_error("MappedFile::MappedFile(ConstLRef<std::string>, MappedFileAccess, Bool): Can't get file size!");
+    }
+
+    _fileHandle = fileHandle;
+
+    _size = StaticCast<U64>(fileSize.QuadPart);
+
+    _isOpen = true;
+
+    // large pages are available only for anonymous mappings on Windows, so hint is ignored
+    static_cast<Void>(useHugePages);
+
+    if (_size == 0) {
+        return;
+    }
+
+    _mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (_mappingHandle == nullptr) {
+        Close();
+
+        throw std::runtime_error("MappedFile::MappedFile(ConstLRef<std::string>, MappedFileAccess, Bool): Can't create file mapping!");
+    }
+
+    _data = StaticCast<ConstPtr<U8>>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+
+    if (_data == nullptr) {
+        Close();
+
+        throw std::runtime_error("MappedFile::MappedFile(ConstLRef<std::string>, MappedFileAccess, Bool): Can't map file!");
+    }
+
+#else
+
+    auto fileDescriptor = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+
+    if (fileDescriptor < 0) {
+        throw std::runtime_error("MappedFile::MappedFile(ConstLRef<std::string>, MappedFileAccess, Bool): Can't open file!");
+    }
+
+    struct stat fileStat {};
+
+    if (fstat(fileDescriptor, &fileStat) != 0) {
+        close(fileDescriptor);
+
+        throw std::runtime_error("MappedFile::MappedFile(ConstLRef<std::string>, MappedFileAccess, Bool): Can't get file size!");
+    }
+
+    _size = StaticCast<U64>(fileStat.st_size);
+
+    _isOpen = true;
+
+    if (_size == 0) {
+        close(fileDescriptor);
+
+        return;
+    }
+
+    auto data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // mapping keeps reference to file
+    close(fileDescriptor);
+
+    if (data == MAP_FAILED) {
+        _size = 0;
+
+        _isOpen = false;
+
+        throw std::runtime_error("MappedFile::MappedFile(ConstLRef<std::string>, MappedFileAccess, Bool): Can't map file!");
+    }
+
+    _data = StaticCast<ConstPtr<U8>>(data);
+
+    // hints are advisory, so errors are ignored
+    if (access == MappedFileAccess::Sequential) {
+        madvise(data, _size, MADV_SEQUENTIAL);
+    } else if (access == MappedFileAccess::Random) {
+        madvise(data, _size, MADV_RANDOM);
+    }
+
+#if defined(MADV_HUGEPAGE)
+
+    if (useHugePages) {
+        madvise(data, _size, MADV_HUGEPAGE);
+    }
+
+#else
+
+    static_cast<Void>(useHugePages);
+
+#endif
+
+#endif
+}
+
+MappedFile::MappedFile(RRef<MappedFile> file) noexcept
+        : MappedFile() {
+    *this = std::move(file);
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+Void MappedFile::Close() {
+#if defined(GS_OS_WINDOWS)
+
+    if (_data != nullptr) {
+        UnmapViewOfFile(_data);
+    }
+
+    if (_mappingHandle != nullptr) {
+        CloseHandle(_mappingHandle);
+    }
+
+    if (_fileHandle != nullptr) {
+        CloseHandle(_fileHandle);
+    }
+
+    _fileHandle = nullptr;
+
+    _mappingHandle = nullptr;
+
+#else
+
+    if (_data != nullptr) {
+        munmap(const_cast<Ptr<U8>>(_data), _size);
+    }
+
+#endif
+
+    _data = nullptr;
+
+    _size = 0;
+
+    _isOpen = false;
+}
+
+UTF8View MappedFile::View(ConstLRef<U64> offset, ConstLRef<U64> size) const {
+    if (offset > _size) {
+        throw std::runtime_error("MappedFile::View(ConstLRef<U64>, ConstLRef<U64>) const: Offset out of range!");
+    }
+
+    // validation fails for views starting or ending inside of symbol
+    return UTF8View(_data + offset, size < _size - offset ? size : _size - offset);
+}
+
+LRef<MappedFile> MappedFile::operator=(RRef<MappedFile> file) noexcept {
+    if (this == &file) {
+        return *this;
+    }
+
+    Close();
+
+    _data = file._data;
+
+    _size = file._size;
+
+    _isOpen = file._isOpen;
+
+#if defined(GS_OS_WINDOWS)
+
+    _fileHandle = file._fileHandle;
+
+    _mappingHandle = file._mappingHandle;
+
+    file._fileHandle = nullptr;
+
+    file._mappingHandle = nullptr;
+
+#endif
+
+    file._data = nullptr;
+
+    file._size = 0;
+
+    file._isOpen = false;
+
+    return *this;
+}
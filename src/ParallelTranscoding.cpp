@@ -0,0 +1,174 @@
+#include <thread>
+#include <vector>
+
+#include <GSCrossPlatform/ParallelTranscoding.h>
+
+U32 ParallelTranscodingThreadsCount() {
+    auto threadsCount = std::thread::hardware_concurrency();
+
+    return threadsCount > 0 ? threadsCount : 1;
+}
+
+/**
+ * Moving chunk boundary in UTF-8 before sequence, which continues after boundary
+ */
+static U64 UTF8ChunkBoundary(ConstPtr<C> bytes, ConstLRef<U64> size, U64 position) {
+    for (U64 index = 1; index <= 3 && position < size; ++index) {
+        auto byte = StaticCast<U8>(bytes[position - index]);
+
+        if ((byte & 0xC0) != 0x80) {
+            if (byte >= 0xC0 && UTF8Size(byte) > index) {
+                position -= index;
+            }
+
+            break;
+        }
+    }
+
+    return position;
+}
+
+/**
+ * Moving chunk boundary in UTF-16 after surrogate pair, which is split by boundary
+ */
+static U64 UTF16ChunkBoundary(ConstPtr<C16> units, ConstLRef<U64> size, U64 position) {
+    if (position < size && IsHighSurrogate(units[position - 1]) && IsLowSurrogate(units[position])) {
+        ++position;
+    }
+
+    return position;
+}
+
+static U64 UTF32ChunkBoundary(ConstPtr<C32>, ConstLRef<U64>, U64 position) {
+    return position;
+}
+
+template<typename OutputStringT, typename InputT, typename BoundaryT, typename LengthT, typename TranscodeT>
+static OutputStringT TranscodeParallel(ConstPtr<InputT> input,
+                                       ConstLRef<U64> size,
+                                       U32 threadsCount,
+                                       BoundaryT boundary,
+                                       LengthT length,
+                                       TranscodeT transcode) {
+    OutputStringT output;
+
+    if (threadsCount == 0) {
+        threadsCount = ParallelTranscodingThreadsCount();
+    }
+
+    auto chunksCount = size / ParallelTranscodingChunkSize;
+
+    if (chunksCount > threadsCount) {
+        chunksCount = threadsCount;
+    }
+
+    if (chunksCount < 2) {
+        output.resize(length(input, size));
+
+        transcode(input, size, output.data());
+
+        return output;
+    }
+
+    std::vector<U64> boundaries(chunksCount + 1), offsets(chunksCount + 1);
+
+    boundaries[0] = 0;
+
+    boundaries[chunksCount] = size;
+
+    for (U64 index = 1; index < chunksCount; ++index) {
+        boundaries[index] = boundary(input, size, size / chunksCount * index);
+    }
+
+    auto runChunks = [&] (auto function) {
+        std::vector<std::thread> threads;
+
+        threads.reserve(chunksCount - 1);
+
+        for (U64 index = 1; index < chunksCount; ++index) {
+            threads.emplace_back(function, index);
+        }
+
+        function(0);
+
+        for (auto &thread : threads) {
+            thread.join();
+        }
+    };
+
+    runChunks([&] (U64 index) {
+        offsets[index + 1] = length(input + boundaries[index], boundaries[index + 1] - boundaries[index]);
+    });
+
+    for (U64 index = 1; index <= chunksCount; ++index) {
+        offsets[index] += offsets[index - 1];
+    }
+
+    output.resize(offsets[chunksCount]);
+
+    runChunks([&] (U64 index) {
+        transcode(input + boundaries[index], boundaries[index + 1] - boundaries[index], output.data() + offsets[index]);
+    });
+
+    return output;
+}
+
+std::u32string ParallelUTF8ToUTF32(ConstPtr<C> bytes, ConstLRef<U64> size, U32 threadsCount) {
+    return TranscodeParallel<std::u32string>(bytes, size, threadsCount, UTF8ChunkBoundary,
+                                             [] (ConstPtr<C> input, ConstLRef<U64> inputSize) {
+                                                 return UTF8ToUTF32Length(input, inputSize);
+                                             },
+                                             [] (ConstPtr<C> input, ConstLRef<U64> inputSize, Ptr<C32> output) {
+                                                 return UTF8ToUTF32(input, inputSize, output);
+                                             });
+}
+
+std::u16string ParallelUTF8ToUTF16(ConstPtr<C> bytes, ConstLRef<U64> size, U32 threadsCount) {
+    return TranscodeParallel<std::u16string>(bytes, size, threadsCount, UTF8ChunkBoundary,
+                                             [] (ConstPtr<C> input, ConstLRef<U64> inputSize) {
+                                                 return UTF8ToUTF16Length(input, inputSize);
+                                             },
+                                             [] (ConstPtr<C> input, ConstLRef<U64> inputSize, Ptr<C16> output) {
+                                                 return UTF8ToUTF16(input, inputSize, output);
+                                             });
+}
+
+std::string ParallelUTF16ToUTF8(ConstPtr<C16> units, ConstLRef<U64> size, U32 threadsCount) {
+    return TranscodeParallel<std::string>(units, size, threadsCount, UTF16ChunkBoundary,
+                                          [] (ConstPtr<C16> input, ConstLRef<U64> inputSize) {
+                                              return UTF16ToUTF8Length(input, inputSize);
+                                          },
+                                          [] (ConstPtr<C16> input, ConstLRef<U64> inputSize, Ptr<C> output) {
+                                              return UTF16ToUTF8(input, inputSize, output);
+                                          });
+}
+
+std::u32string ParallelUTF16ToUTF32(ConstPtr<C16> units, ConstLRef<U64> size, U32 threadsCount) {
+    return TranscodeParallel<std::u32string>(units, size, threadsCount, UTF16ChunkBoundary,
+                                             [] (ConstPtr<C16> input, ConstLRef<U64> inputSize) {
+                                                 return UTF16ToUTF32Length(input, inputSize);
+                                             },
+                                             [] (ConstPtr<C16> input, ConstLRef<U64> inputSize, Ptr<C32> output) {
+                                                 return UTF16ToUTF32(input, inputSize, output);
+                                             });
+}
+
+std::string ParallelUTF32ToUTF8(ConstPtr<C32> codePoints, ConstLRef<U64> size, U32 threadsCount) {
+    return TranscodeParallel<std::string>(codePoints, size, threadsCount, UTF32ChunkBoundary,
+                                          [] (ConstPtr<C32> input, ConstLRef<U64> inputSize) {
+                                              return UTF32ToUTF8Length(input, inputSize);
+                                          },
+                                          [] (ConstPtr<C32> input, ConstLRef<U64> inputSize, Ptr<C> output) {
+                                              return UTF32ToUTF8(input, inputSize, output);
+                                          });
+}
+
+std::u16string ParallelUTF32ToUTF16(ConstPtr<C32> codePoints, ConstLRef<U64> size, U32 threadsCount) {
+    return TranscodeParallel<std::u16string>(codePoints, size, threadsCount, UTF32ChunkBoundary,
+                                             [] (ConstPtr<C32> input, ConstLRef<U64> inputSize) {
+                                                 return UTF32ToUTF16Length(input, inputSize);
+                                             },
+                                             [] (ConstPtr<C32> input, ConstLRef<U64> inputSize, Ptr<C16> output) {
+                                                 return UTF32ToUTF16(input, inputSize, output);
+                                             });
+}
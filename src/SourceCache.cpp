@@ -0,0 +1,158 @@
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include <GSCrossPlatform/SourceCache.h>
+
+SourceBuffer::SourceBuffer(Vector<U8> bytes, U32 checksum)
+        : _bytes(std::move(bytes)), _checksum(checksum) {}
+
+ConstLRef<UString> SourceBuffer::Text() const {
+    std::call_once(_textFlag, [this] () {
+        _text = UString(ReinterpretCast<ConstPtr<C>>(_bytes.Data()), _bytes.Size());
+    });
+
+    return _text;
+}
+
+ConstLRef<LineIndex> SourceBuffer::Lines() const {
+    std::call_once(_linesFlag, [this] () {
+        _lines = LineIndex(Text());
+    });
+
+    return _lines;
+}
+
+LRef<SourceCache> SourceCache::Instance() {
+    static SourceCache cache;
+
+    return cache;
+}
+
+std::shared_ptr<Const<SourceBuffer>> SourceCache::Load(ConstLRef<std::string> path) {
+    auto key = std::filesystem::path(path).lexically_normal().string();
+
+    std::error_code error;
+
+    auto modificationTime = StaticCast<I64>(std::filesystem::last_write_time(key, error).time_since_epoch().count());
+
+    auto size = error ? 0 : StaticCast<U64>(std::filesystem::file_size(key, error));
+
+    if (error) {
+        throw std::runtime_error("SourceCache::Load(ConstLRef<std::string>): Can't get file status!");
+    }
+
+    {
+        std::lock_guard lock(_mutex);
+
+        auto entry = _entries.find(key);
+
+        if (entry != _entries.end() && entry->second.IsValid(modificationTime, size)) {
+            return entry->second.Buffer();
+        }
+    }
+
+    // file is read and hashed without lock, so other files can be loaded concurrently
+    auto file = std::fopen(key.c_str(), "rb");
+
+    if (file == nullptr) {
+        throw std::runtime_error("SourceCache::Load(ConstLRef<std::string>): Can't open file!");
+    }
+
+    Vector<U8> bytes;
+
+    bytes.Resize(size);
+
+    auto bytesCount = std::fread(bytes.Data(), 1, size, file);
+
+    auto isFailed = std::ferror(file) != 0;
+
+    std::fclose(file);
+
+    if (isFailed) {
+        throw std::runtime_error("SourceCache::Load(ConstLRef<std::string>): Can't read file!");
+    }
+
+    // file can be truncated between getting status and reading
+    bytes.Resize(bytesCount);
+
+    auto checksum = CRC32C(bytes.Data(), bytes.Size());
+
+    auto buffer = Deduplicate(std::move(bytes), checksum);
+
+    std::lock_guard lock(_mutex);
+
+    _entries.insert_or_assign(key, Entry(buffer, modificationTime, size));
+
+    return buffer;
+}
+
+Void SourceCache::Invalidate(ConstLRef<std::string> path) {
+    std::lock_guard lock(_mutex);
+
+    _entries.erase(std::filesystem::path(path).lexically_normal().string());
+}
+
+Void SourceCache::Clear() {
+    std::lock_guard lock(_mutex);
+
+    _entries.clear();
+
+    _buffers.clear();
+}
+
+U64 SourceCache::Size() const {
+    std::lock_guard lock(_mutex);
+
+    return _entries.size();
+}
+
+std::shared_ptr<Const<SourceBuffer>> SourceCache::Deduplicate(RRef<Vector<U8>> bytes, U32 checksum) {
+    std::vector<std::shared_ptr<Const<SourceBuffer>>> candidates;
+
+    {
+        std::lock_guard lock(_mutex);
+
+        auto entry = _buffers.find(checksum);
+
+        if (entry != _buffers.end()) {
+            auto &buffers = entry->second;
+
+            for (auto index = buffers.size(); index > 0; --index) {
+                auto candidate = buffers[index - 1].lock();
+
+                // buffers are released by users and replaced entries, so expired references are removed
+                if (candidate == nullptr) {
+                    buffers.erase(buffers.begin() + StaticCast<I64>(index - 1));
+
+                    continue;
+                }
+
+                if (candidate->Size() == bytes.Size()) {
+                    candidates.push_back(std::move(candidate));
+                }
+            }
+
+            if (buffers.empty()) {
+                _buffers.erase(entry);
+            }
+        }
+    }
+
+    // bytes are compared without lock, candidates are kept alive by shared references
+    for (auto &candidate : candidates) {
+        if (bytes.Size() == 0 || std::memcmp(candidate->Bytes().Data(), bytes.Data(), bytes.Size()) == 0) {
+            return candidate;
+        }
+    }
+
+    auto buffer = std::make_shared<Const<SourceBuffer>>(std::move(bytes), checksum);
+
+    // equal file loaded concurrently can get its own buffer, it is only missed sharing
+    std::lock_guard lock(_mutex);
+
+    _buffers[checksum].emplace_back(buffer);
+
+    return buffer;
+}
@@ -1,23 +1,66 @@
 #include <unicode/uchar.h>
+#include <unicode/ustring.h>
+#include <unicode/utf16.h>
 
 #include <GSCrossPlatform/IO.h>
 
-Bool USymbol::IsAlpha() const {
-    return u_isalpha(StaticCast<UChar32>(_codePoint));
+USymbol USymbol::UnicodeToUpper() const {
+    return USymbol(StaticCast<U32>(u_toupper(StaticCast<UChar32>(_codePoint))));
 }
 
-Bool USymbol::IsDigit() const {
-    return u_isdigit(StaticCast<UChar32>(_codePoint));
+USymbol USymbol::UnicodeToLower() const {
+    return USymbol(StaticCast<U32>(u_tolower(StaticCast<UChar32>(_codePoint))));
 }
 
-Bool USymbol::IsWhitespace() const {
-    return u_isspace(StaticCast<UChar32>(_codePoint));
+USymbol USymbol::UnicodeCaseFold() const {
+    return USymbol(StaticCast<U32>(u_foldCase(StaticCast<UChar32>(_codePoint), U_FOLD_CASE_DEFAULT)));
 }
 
-Bool USymbol::IsIDStart() const {
-    return u_isIDStart(StaticCast<UChar32>(_codePoint));
+static I32 MapUTF16Case(Ptr<UChar> destination, I32 destinationCapacity, ConstPtr<UChar> source, I32 sourceLength, CaseMapping mapping, LRef<UErrorCode> errorCode) {
+    switch (mapping) {
+        case CaseMapping::Upper:
+            return u_strToUpper(destination, destinationCapacity, source, sourceLength, "", &errorCode);
+        case CaseMapping::Lower:
+            return u_strToLower(destination, destinationCapacity, source, sourceLength, "", &errorCode);
+        default:
+            return u_strFoldCase(destination, destinationCapacity, source, sourceLength, U_FOLD_CASE_DEFAULT, &errorCode);
+    }
 }
 
-Bool USymbol::IsIDContinue() const {
-    return u_isIDPart(StaticCast<UChar32>(_codePoint));
+Void AppendUnicodeCaseMapped(UStringView string, CaseMapping mapping, LRef<UString> outputString) {
+    std::u16string source;
+
+    source.resize(UTF32ToUTF16Length(string.Data(), string.Size()));
+
+    UTF32ToUTF16(string.Data(), string.Size(), source.data());
+
+    auto sourcePointer = ReinterpretCast<ConstPtr<UChar>>(source.data());
+
+    auto sourceLength = StaticCast<I32>(source.size());
+
+    std::u16string destination(source.size() + 16, 0);
+
+    auto errorCode = U_ZERO_ERROR;
+
+    auto destinationLength = MapUTF16Case(ReinterpretCast<Ptr<UChar>>(destination.data()), StaticCast<I32>(destination.size()), sourcePointer, sourceLength, mapping, errorCode);
+
+    if (errorCode == U_BUFFER_OVERFLOW_ERROR) {
+        destination.resize(destinationLength);
+
+        errorCode = U_ZERO_ERROR;
+
+        destinationLength = MapUTF16Case(ReinterpretCast<Ptr<UChar>>(destination.data()), StaticCast<I32>(destination.size()), sourcePointer, sourceLength, mapping, errorCode);
+    }
+
+    if (U_FAILURE(errorCode)) {
+        outputString.Append(string);
+
+        return;
+    }
+
+    auto outputSize = outputString.Size();
+
+    outputString.Resize(outputSize + UTF16ToUTF32Length(destination.data(), StaticCast<U64>(destinationLength)));
+
+    UTF16ToUTF32(destination.data(), StaticCast<U64>(destinationLength), outputString.Data() + outputSize);
 }
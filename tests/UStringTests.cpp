@@ -0,0 +1,32 @@
+#include <iostream>
+
+#include <GSCrossPlatform/UString.h>
+
+/**
+ * Regression checks for UString
+ *
+ * Returns count of failed checks as exit code
+ */
+
+static I32 FailedCount = 0;
+
+Void Check(Bool condition, ConstPtr<C> name) {
+    if (!condition) {
+        std::cerr << "Failed: " << name << std::endl;
+
+        ++FailedCount;
+    }
+}
+
+I32 main() {
+    // final sigma depends on letters around non ASCII run
+    Check(ToLower(UString(U"ΟΔΟΣA")) == UString(U"οδοσa"), "ToLower(\"ΟΔΟΣA\")");
+
+    Check(ToLower(UString(U"ΟΔΟΣ")) == UString(U"οδος"), "ToLower(\"ΟΔΟΣ\")");
+
+    Check(ToLower(UString(U"AΣ")) == UString(U"aς"), "ToLower(\"AΣ\")");
+
+    Check(HashIgnoreCase(UString(U"ΟΔΟΣA")) == Hash(CaseFold(UString(U"ΟΔΟΣA"))), "HashIgnoreCase(\"ΟΔΟΣA\")");
+
+    return FailedCount;
+}
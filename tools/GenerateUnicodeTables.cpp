@@ -0,0 +1,304 @@
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <vector>
+
+#include <unicode/uchar.h>
+
+#include <GSCrossPlatform/Types.h>
+
+/**
+ * Generator of GSCrossPlatform/UnicodeTables.h
+ *
+ * Reads Unicode Character Database properties through ICU and writes them as
+ * compact two-stage lookup tables, so that library doesn't call ICU at runtime.
+ *
+ * Usage: GenerateUnicodeTables <output header path>
+ */
+
+inline constexpr U32 MaxCodePoint = 0x10FFFF;
+
+inline constexpr ConstPtr<C> GraphemeBreakNames[] = {
+        "Other", "CR", "LF", "Control", "Extend", "ZWJ", "RegionalIndicator",
+        "Prepend", "SpacingMark", "L", "V", "T", "LV", "LVT"
+};
+
+inline constexpr ConstPtr<C> WordBreakNames[] = {
+        "Other", "CR", "LF", "Newline", "Extend", "ZWJ", "RegionalIndicator", "Format",
+        "Katakana", "HebrewLetter", "ALetter", "SingleQuote", "DoubleQuote", "MidNumLet",
+        "MidLetter", "MidNum", "Numeric", "ExtendNumLet", "WSegSpace"
+};
+
+inline constexpr ConstPtr<C> SentenceBreakNames[] = {
+        "Other", "CR", "LF", "Extend", "Sep", "Format", "Sp", "Lower",
+        "Upper", "OLetter", "Numeric", "ATerm", "SContinue", "STerm", "Close"
+};
+
+inline constexpr ConstPtr<C> FlagNames[] = {
+        "ExtendedPictographic", "Alpha", "Digit", "Whitespace", "IDStart", "IDContinue"
+};
+
+U32 GraphemeBreakOf(UChar32 codePoint) {
+    switch (u_getIntPropertyValue(codePoint, UCHAR_GRAPHEME_CLUSTER_BREAK)) {
+        case U_GCB_CR:                 return 1;
+        case U_GCB_LF:                 return 2;
+        case U_GCB_CONTROL:            return 3;
+        case U_GCB_EXTEND:             return 4;
+        case U_GCB_ZWJ:                return 5;
+        case U_GCB_REGIONAL_INDICATOR: return 6;
+        case U_GCB_PREPEND:            return 7;
+        case U_GCB_SPACING_MARK:       return 8;
+        case U_GCB_L:                  return 9;
+        case U_GCB_V:                  return 10;
+        case U_GCB_T:                  return 11;
+        case U_GCB_LV:                 return 12;
+        case U_GCB_LVT:                return 13;
+        default:                       return 0;
+    }
+}
+
+U32 WordBreakOf(UChar32 codePoint) {
+    switch (u_getIntPropertyValue(codePoint, UCHAR_WORD_BREAK)) {
+        case U_WB_CR:                 return 1;
+        case U_WB_LF:                 return 2;
+        case U_WB_NEWLINE:            return 3;
+        case U_WB_EXTEND:             return 4;
+        case U_WB_ZWJ:                return 5;
+        case U_WB_REGIONAL_INDICATOR: return 6;
+        case U_WB_FORMAT:             return 7;
+        case U_WB_KATAKANA:           return 8;
+        case U_WB_HEBREW_LETTER:      return 9;
+        case U_WB_ALETTER:            return 10;
+        case U_WB_SINGLE_QUOTE:       return 11;
+        case U_WB_DOUBLE_QUOTE:       return 12;
+        case U_WB_MIDNUMLET:          return 13;
+        case U_WB_MIDLETTER:          return 14;
+        case U_WB_MIDNUM:             return 15;
+        case U_WB_NUMERIC:            return 16;
+        case U_WB_EXTENDNUMLET:       return 17;
+        case U_WB_WSEGSPACE:          return 18;
+        default:                      return 0;
+    }
+}
+
+U32 SentenceBreakOf(UChar32 codePoint) {
+    switch (u_getIntPropertyValue(codePoint, UCHAR_SENTENCE_BREAK)) {
+        case U_SB_CR:        return 1;
+        case U_SB_LF:        return 2;
+        case U_SB_EXTEND:    return 3;
+        case U_SB_SEP:       return 4;
+        case U_SB_FORMAT:    return 5;
+        case U_SB_SP:        return 6;
+        case U_SB_LOWER:     return 7;
+        case U_SB_UPPER:     return 8;
+        case U_SB_OLETTER:   return 9;
+        case U_SB_NUMERIC:   return 10;
+        case U_SB_ATERM:     return 11;
+        case U_SB_SCONTINUE: return 12;
+        case U_SB_STERM:     return 13;
+        case U_SB_CLOSE:     return 14;
+        default:             return 0;
+    }
+}
+
+U32 FlagsOf(UChar32 codePoint) {
+    Bool flags[] = {
+            StaticCast<Bool>(u_hasBinaryProperty(codePoint, UCHAR_EXTENDED_PICTOGRAPHIC)),
+            StaticCast<Bool>(u_isalpha(codePoint)),
+            StaticCast<Bool>(u_isdigit(codePoint)),
+            StaticCast<Bool>(u_isspace(codePoint)),
+            StaticCast<Bool>(u_isIDStart(codePoint)),
+            StaticCast<Bool>(u_isIDPart(codePoint))
+    };
+
+    U32 flagsMask = 0;
+
+    for (U32 index = 0; index < std::size(flags); ++index) {
+        flagsMask |= flags[index] ? 1U << index : 0;
+    }
+
+    return flagsMask;
+}
+
+U32 RecordOf(UChar32 codePoint) {
+    return GraphemeBreakOf(codePoint)
+         | (WordBreakOf(codePoint) << 8)
+         | (SentenceBreakOf(codePoint) << 16)
+         | (FlagsOf(codePoint) << 24);
+}
+
+class Tables {
+public:
+
+    U32 Shift = 0;
+
+    std::vector<U32> Records;
+
+    std::vector<U32> Stage1;
+
+    std::vector<U32> Stage2;
+
+public:
+
+    U64 SizeInBytes() const {
+        auto stage1EntrySize = Stage2.size() / (1 << Shift) > 256 ? 2 : 1;
+
+        auto stage2EntrySize = Records.size() > 256 ? 2 : 1;
+
+        return Stage1.size() * stage1EntrySize + Stage2.size() * stage2EntrySize + Records.size() * 4;
+    }
+};
+
+Tables BuildTables(ConstLRef<std::vector<U32>> recordIndexes, ConstLRef<std::vector<U32>> records, U32 shift) {
+    Tables tables;
+
+    tables.Shift = shift;
+
+    tables.Records = records;
+
+    std::map<std::vector<U32>, U32> blockIndexes;
+
+    auto blockSize = 1U << shift;
+
+    for (U32 blockStart = 0; blockStart <= MaxCodePoint; blockStart += blockSize) {
+        std::vector<U32> block(recordIndexes.begin() + blockStart, recordIndexes.begin() + blockStart + blockSize);
+
+        auto iterator = blockIndexes.find(block);
+
+        if (iterator == blockIndexes.end()) {
+            iterator = blockIndexes.emplace(block, StaticCast<U32>(blockIndexes.size())).first;
+
+            tables.Stage2.insert(tables.Stage2.end(), block.begin(), block.end());
+        }
+
+        tables.Stage1.push_back(iterator->second);
+    }
+
+    return tables;
+}
+
+Void WriteArray(LRef<std::ofstream> stream, ConstPtr<C> name, ConstLRef<std::vector<U32>> values, ConstPtr<C> type, U32 width) {
+    stream << "inline constexpr " << type << " " << name << "[] = {";
+
+    for (U64 index = 0; index < values.size(); ++index) {
+        if (index % width == 0) {
+            stream << "\n        ";
+        }
+
+        stream << values[index] << (index + 1 < values.size() ? "," : "");
+    }
+
+    stream << "\n};\n\n";
+}
+
+template<U64 SizeV>
+Void WriteEnum(LRef<std::ofstream> stream, ConstPtr<C> name, Const<ConstPtr<C>> (&names)[SizeV]) {
+    stream << "enum class " << name << " : U8 {\n";
+
+    for (U64 index = 0; index < SizeV; ++index) {
+        stream << "    " << names[index] << (index + 1 < SizeV ? ",\n" : "\n");
+    }
+
+    stream << "};\n\n";
+}
+
+I32 main(I32 argc, Ptr<Ptr<C>> argv) {
+    if (argc != 2) {
+        return 1;
+    }
+
+    std::vector<U32> records = {0};
+
+    std::map<U32, U32> recordIndexes = {{0, 0}};
+
+    std::vector<U32> codePointRecordIndexes(MaxCodePoint + 1);
+
+    for (UChar32 codePoint = 0; codePoint <= StaticCast<UChar32>(MaxCodePoint); ++codePoint) {
+        auto record = RecordOf(codePoint);
+
+        auto iterator = recordIndexes.find(record);
+
+        if (iterator == recordIndexes.end()) {
+            iterator = recordIndexes.emplace(record, StaticCast<U32>(records.size())).first;
+
+            records.push_back(record);
+        }
+
+        codePointRecordIndexes[codePoint] = iterator->second;
+    }
+
+    auto tables = BuildTables(codePointRecordIndexes, records, 4);
+
+    for (U32 shift = 5; shift <= 10; ++shift) {
+        auto candidateTables = BuildTables(codePointRecordIndexes, records, shift);
+
+        if (candidateTables.SizeInBytes() < tables.SizeInBytes()) {
+            tables = candidateTables;
+        }
+    }
+
+    auto stage1Type = tables.Stage2.size() / (1 << tables.Shift) > 256 ? "U16" : "U8";
+
+    auto stage2Type = tables.Records.size() > 256 ? "U16" : "U8";
+
+    std::ofstream stream(argv[1]);
+
+    stream << "#ifndef GSCROSSPLATFORM_UNICODETABLES_H\n"
+              "#define GSCROSSPLATFORM_UNICODETABLES_H\n\n"
+              "/**\n"
+              " * Generated by tools/GenerateUnicodeTables.cpp from Unicode " << U_UNICODE_VERSION << " Character Database, don't edit!\n"
+              " */\n\n"
+              "#include <GSCrossPlatform/Types.h>\n\n";
+
+    WriteEnum(stream, "GraphemeBreak", GraphemeBreakNames);
+
+    WriteEnum(stream, "WordBreak", WordBreakNames);
+
+    WriteEnum(stream, "SentenceBreak", SentenceBreakNames);
+
+    stream << "inline constexpr U32 UnicodeTablesShift = " << tables.Shift << ";\n\n";
+
+    WriteArray(stream, "UnicodeTablesStage1", tables.Stage1, stage1Type, 24);
+
+    WriteArray(stream, "UnicodeTablesStage2", tables.Stage2, stage2Type, 32);
+
+    WriteArray(stream, "UnicodeTablesRecords", tables.Records, "U32", 8);
+
+    std::vector<U32> asciiRecords;
+
+    for (UChar32 codePoint = 0; codePoint < 0x80; ++codePoint) {
+        asciiRecords.push_back(RecordOf(codePoint));
+    }
+
+    WriteArray(stream, "UnicodeTablesASCIIRecords", asciiRecords, "U32", 8);
+
+    for (U32 index = 0; index < std::size(FlagNames); ++index) {
+        stream << "inline constexpr U32 Unicode" << FlagNames[index] << "Flag = 1U << " << 24 + index << ";\n\n";
+    }
+
+    stream << "inline constexpr U32 UnicodePropertiesOf(ConstLRef<U32> codePoint) {\n"
+              "    if (codePoint < 0x80) {\n"
+              "        return UnicodeTablesASCIIRecords[codePoint];\n"
+              "    }\n\n"
+              "    if (codePoint > 0x10FFFF) {\n"
+              "        return UnicodeTablesRecords[0];\n"
+              "    }\n\n"
+              "    auto block = StaticCast<U32>(UnicodeTablesStage1[codePoint >> UnicodeTablesShift]);\n\n"
+              "    return UnicodeTablesRecords[UnicodeTablesStage2[(block << UnicodeTablesShift) + (codePoint & ((1 << UnicodeTablesShift) - 1))]];\n"
+              "}\n\n"
+              "inline constexpr GraphemeBreak GraphemeBreakOf(ConstLRef<U32> codePoint) {\n"
+              "    return StaticCast<GraphemeBreak>(UnicodePropertiesOf(codePoint) & 0xFF);\n"
+              "}\n\n"
+              "inline constexpr WordBreak WordBreakOf(ConstLRef<U32> codePoint) {\n"
+              "    return StaticCast<WordBreak>((UnicodePropertiesOf(codePoint) >> 8) & 0xFF);\n"
+              "}\n\n"
+              "inline constexpr SentenceBreak SentenceBreakOf(ConstLRef<U32> codePoint) {\n"
+              "    return StaticCast<SentenceBreak>((UnicodePropertiesOf(codePoint) >> 16) & 0xFF);\n"
+              "}\n\n"
+              "inline constexpr Bool IsExtendedPictographic(ConstLRef<U32> codePoint) {\n"
+              "    return (UnicodePropertiesOf(codePoint) & UnicodeExtendedPictographicFlag) != 0;\n"
+              "}\n\n"
+              "#endif //GSCROSSPLATFORM_UNICODETABLES_H\n";
+
+    return 0;
+}